@@ -0,0 +1,73 @@
+#include "benchdata.h"
+#include "benchmark.h"
+#include "path/path.h"
+
+using namespace rpf;
+using namespace rpf::bench;
+
+namespace {
+    constexpr int EVAL_POINTS = 1024;
+
+    // Evaluates the position and first two derivatives along a path of the type in the arg
+    void path_eval(State &state) {
+        Path path(make_waypoints(5), 2, static_cast<PathType>(state.get_arg()));
+        double dt = 1.0 / EVAL_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < EVAL_POINTS; i++) {
+                do_not_optimize(path.at(i * dt));
+                do_not_optimize(path.deriv_at(i * dt));
+                do_not_optimize(path.second_deriv_at(i * dt));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * EVAL_POINTS);
+    }
+    // The args are the values of PathType, from BEZIER to CLOTHOID
+    RPF_BENCHMARK_ARGS(path_eval, 1, 2, 3, 4, 5);
+
+    void path_construct(State &state) {
+        auto waypoints = make_waypoints(state.get_arg());
+        while (state.keep_running()) {
+            Path path(waypoints, 2, PathType::QUINTIC_HERMITE);
+            do_not_optimize(path);
+        }
+    }
+    RPF_BENCHMARK_ARGS(path_construct, 2, 5, 20);
+
+    // compute_len() appends to the lookup table, so every iteration needs a new path
+    void path_compute_len(State &state) {
+        auto waypoints = make_waypoints(5);
+        while (state.keep_running()) {
+            state.pause_timing();
+            Path path(waypoints, 2, PathType::QUINTIC_HERMITE);
+            state.resume_timing();
+            do_not_optimize(path.compute_len(state.get_arg()));
+        }
+    }
+    RPF_BENCHMARK_ARGS(path_compute_len, 100, 1000, 10000);
+
+    void path_s2t(State &state) {
+        Path path(make_waypoints(5), 2, PathType::QUINTIC_HERMITE);
+        path.compute_len(state.get_arg());
+        double ds = 1.0 / EVAL_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < EVAL_POINTS; i++) {
+                do_not_optimize(path.s2t(i * ds));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * EVAL_POINTS);
+    }
+    RPF_BENCHMARK_ARGS(path_s2t, 100, 1000, 10000);
+
+    void path_t2s(State &state) {
+        Path path(make_waypoints(5), 2, PathType::QUINTIC_HERMITE);
+        path.compute_len(state.get_arg());
+        double dt = 1.0 / EVAL_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < EVAL_POINTS; i++) {
+                do_not_optimize(path.t2s(i * dt));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * EVAL_POINTS);
+    }
+    RPF_BENCHMARK_ARGS(path_t2s, 100, 1000, 10000);
+} // namespace
@@ -0,0 +1,61 @@
+#include "benchmark.h"
+#include "util/instancelist.h"
+#include <vector>
+
+using namespace rpf;
+using namespace rpf::bench;
+
+namespace {
+    struct Object {
+        double value = 0;
+    };
+
+    /*
+     * Every JNI call looks up its native object in a list of live instances, under a mutex.
+     * These measure the lookup with the number of live instances as the arg.
+     */
+    void registry_check_instance(State &state) {
+        std::list<std::shared_ptr<Object>> instances;
+        std::mutex instances_mutex;
+        for (int i = 0; i < state.get_arg(); i++) {
+            instances.push_back(std::make_shared<Object>());
+        }
+        // The newest object is at the end of the list, which is the worst case
+        Object *newest = instances.back().get();
+        while (state.keep_running()) {
+            do_not_optimize(check_instance(instances, instances_mutex, newest));
+        }
+    }
+    RPF_BENCHMARK_ARGS(registry_check_instance, 1, 16, 256);
+
+    void registry_find_instance(State &state) {
+        std::list<std::shared_ptr<Object>> instances;
+        std::mutex instances_mutex;
+        for (int i = 0; i < state.get_arg(); i++) {
+            instances.push_back(std::make_shared<Object>());
+        }
+        Object *newest = instances.back().get();
+        while (state.keep_running()) {
+            do_not_optimize(find_instance(instances, instances_mutex, newest));
+        }
+    }
+    RPF_BENCHMARK_ARGS(registry_find_instance, 1, 16, 256);
+
+    // Adding a new instance and removing it again, like creating and freeing an object
+    void registry_add_remove(State &state) {
+        std::list<std::shared_ptr<Object>> instances;
+        std::mutex instances_mutex;
+        for (int i = 0; i < state.get_arg(); i++) {
+            instances.push_back(std::make_shared<Object>());
+        }
+        while (state.keep_running()) {
+            auto obj = std::make_shared<Object>();
+            {
+                std::lock_guard<std::mutex> lock(instances_mutex);
+                instances.push_back(obj);
+            }
+            do_not_optimize(remove_instance(instances, instances_mutex, obj.get()));
+        }
+    }
+    RPF_BENCHMARK_ARGS(registry_add_remove, 1, 16, 256);
+} // namespace
@@ -0,0 +1,264 @@
+#include "benchdata.h"
+#include "benchmark.h"
+#include "motionprofiles.h"
+#include "trajectories.h"
+
+using namespace rpf;
+using namespace rpf::bench;
+
+namespace {
+    constexpr int QUERY_POINTS = 1024;
+
+    TankDriveTrajectory make_tank(int samples) {
+        return TankDriveTrajectory(make_specs(), make_params(5, samples, true));
+    }
+
+    // Generation across sample counts
+    void basic_trajectory_samples(State &state) {
+        auto specs = make_specs();
+        auto params = make_params(5, state.get_arg(), false);
+        while (state.keep_running()) {
+            BasicTrajectory traj(specs, params);
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK_ARGS(basic_trajectory_samples, 100, 1000, 10000);
+
+    void tank_trajectory_samples(State &state) {
+        auto specs = make_specs();
+        auto params = make_params(5, state.get_arg(), true);
+        while (state.keep_running()) {
+            TankDriveTrajectory traj(specs, params);
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_samples, 100, 1000, 10000);
+
+    // The same, but going through a BasicTrajectory first
+    void tank_trajectory_from_basic(State &state) {
+        auto specs = make_specs();
+        auto params = make_params(5, state.get_arg(), true);
+        while (state.keep_running()) {
+            TankDriveTrajectory traj(BasicTrajectory(specs, params));
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_from_basic, 100, 1000, 10000);
+
+    // The same as tank_trajectory_samples, but generated in small steps, to show the overhead of
+    // stopping and resuming
+    void tank_trajectory_incremental(State &state) {
+        auto specs = make_specs();
+        auto params = make_params(5, state.get_arg(), true);
+        while (state.keep_running()) {
+            IncrementalGenerator gen(specs, params, true);
+            while (!gen.step(0)) {
+            }
+            auto traj = gen.get_tank();
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_incremental, 100, 1000, 10000);
+
+    // The same, but streaming, which also looks for settled moments as it goes
+    void tank_trajectory_streaming(State &state) {
+        auto specs = make_specs();
+        auto params = make_params(5, state.get_arg(), true);
+        while (state.keep_running()) {
+            IncrementalGenerator gen(specs, params, true, true);
+            while (!gen.step(0)) {
+            }
+            auto traj = gen.get_tank();
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_streaming, 100, 1000, 10000);
+
+    // Several speed presets for the same path, generated separately and from one sampled path
+    constexpr int PRESETS = 4;
+
+    RobotSpecs make_preset(int i) {
+        auto specs = make_specs();
+        specs.max_v *= 1 - 0.2 * i;
+        specs.max_a *= 1 - 0.2 * i;
+        return specs;
+    }
+
+    void tank_trajectory_presets(State &state) {
+        auto params = make_params(5, state.get_arg(), true);
+        while (state.keep_running()) {
+            for (int i = 0; i < PRESETS; i++) {
+                TankDriveTrajectory traj(make_preset(i), params);
+                do_not_optimize(traj);
+            }
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_presets, 100, 1000, 10000);
+
+    void tank_trajectory_presets_sampled(State &state) {
+        auto params = make_params(5, state.get_arg(), true);
+        while (state.keep_running()) {
+            auto path = std::make_shared<SampledPath>(params, make_specs().base_width);
+            for (int i = 0; i < PRESETS; i++) {
+                TankDriveTrajectory traj(make_preset(i), path);
+                do_not_optimize(traj);
+            }
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_presets_sampled, 100, 1000, 10000);
+
+    // Generation across waypoint counts
+    void basic_trajectory_waypoints(State &state) {
+        auto specs = make_specs();
+        auto params = make_params(state.get_arg(), 1000, false);
+        while (state.keep_running()) {
+            BasicTrajectory traj(specs, params);
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK_ARGS(basic_trajectory_waypoints, 2, 5, 20);
+
+    void tank_trajectory_waypoints(State &state) {
+        auto specs = make_specs();
+        auto params = make_params(state.get_arg(), 1000, true);
+        while (state.keep_running()) {
+            TankDriveTrajectory traj(specs, params);
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_waypoints, 2, 5, 20);
+
+    // Turns in place
+    void tank_trajectory_rotation(State &state) {
+        auto specs = make_specs();
+        while (state.keep_running()) {
+            TankDriveTrajectory traj((TankDriveRotationProfile(specs, pi / 2)));
+            do_not_optimize(traj);
+        }
+    }
+    RPF_BENCHMARK(tank_trajectory_rotation);
+
+    void tank_trajectory_rotation_get(State &state) {
+        TankDriveTrajectory traj((TankDriveRotationProfile(make_specs(), pi / 2)));
+        double dt = traj.total_time() / QUERY_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < QUERY_POINTS; i++) {
+                do_not_optimize(traj.get(i * dt));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * QUERY_POINTS);
+    }
+    RPF_BENCHMARK(tank_trajectory_rotation_get);
+
+    // Queries, with the sample count as the arg
+    void basic_trajectory_get(State &state) {
+        BasicTrajectory traj(make_specs(), make_params(5, state.get_arg(), false));
+        double dt = traj.total_time() / QUERY_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < QUERY_POINTS; i++) {
+                do_not_optimize(traj.get(i * dt));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * QUERY_POINTS);
+    }
+    RPF_BENCHMARK_ARGS(basic_trajectory_get, 100, 1000, 10000);
+
+    void basic_trajectory_get_pos(State &state) {
+        BasicTrajectory traj(make_specs(), make_params(5, state.get_arg(), false));
+        double dt = traj.total_time() / QUERY_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < QUERY_POINTS; i++) {
+                do_not_optimize(traj.get_pos(i * dt));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * QUERY_POINTS);
+    }
+    RPF_BENCHMARK_ARGS(basic_trajectory_get_pos, 100, 1000, 10000);
+
+    void tank_trajectory_get(State &state) {
+        TankDriveTrajectory traj = make_tank(state.get_arg());
+        double dt = traj.total_time() / QUERY_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < QUERY_POINTS; i++) {
+                do_not_optimize(traj.get(i * dt));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * QUERY_POINTS);
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_get, 100, 1000, 10000);
+
+    // Sequential queries that reuse the cursor, like a follower does
+    void tank_trajectory_get_cursor(State &state) {
+        TankDriveTrajectory traj = make_tank(state.get_arg());
+        double dt = traj.total_time() / QUERY_POINTS;
+        while (state.keep_running()) {
+            std::size_t cursor = 0;
+            for (int i = 0; i < QUERY_POINTS; i++) {
+                do_not_optimize(traj.get(i * dt, cursor));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * QUERY_POINTS);
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_get_cursor, 100, 1000, 10000);
+
+    void tank_trajectory_get_pos(State &state) {
+        TankDriveTrajectory traj = make_tank(state.get_arg());
+        double dt = traj.total_time() / QUERY_POINTS;
+        while (state.keep_running()) {
+            for (int i = 0; i < QUERY_POINTS; i++) {
+                do_not_optimize(traj.get_pos(i * dt));
+            }
+        }
+        state.set_items_processed(state.get_iterations() * QUERY_POINTS);
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_get_pos, 100, 1000, 10000);
+
+    // Mirroring and retracing, with the sample count as the arg
+    void basic_trajectory_mirror_lr(State &state) {
+        BasicTrajectory traj(make_specs(), make_params(5, state.get_arg(), false));
+        while (state.keep_running()) {
+            do_not_optimize(traj.mirror_lr());
+        }
+    }
+    RPF_BENCHMARK_ARGS(basic_trajectory_mirror_lr, 100, 1000, 10000);
+
+    void basic_trajectory_mirror_fb(State &state) {
+        BasicTrajectory traj(make_specs(), make_params(5, state.get_arg(), false));
+        while (state.keep_running()) {
+            do_not_optimize(traj.mirror_fb());
+        }
+    }
+    RPF_BENCHMARK_ARGS(basic_trajectory_mirror_fb, 100, 1000, 10000);
+
+    void basic_trajectory_retrace(State &state) {
+        BasicTrajectory traj(make_specs(), make_params(5, state.get_arg(), false));
+        while (state.keep_running()) {
+            do_not_optimize(traj.retrace());
+        }
+    }
+    RPF_BENCHMARK_ARGS(basic_trajectory_retrace, 100, 1000, 10000);
+
+    void tank_trajectory_mirror_lr(State &state) {
+        TankDriveTrajectory traj = make_tank(state.get_arg());
+        while (state.keep_running()) {
+            do_not_optimize(traj.mirror_lr());
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_mirror_lr, 100, 1000, 10000);
+
+    void tank_trajectory_mirror_fb(State &state) {
+        TankDriveTrajectory traj = make_tank(state.get_arg());
+        while (state.keep_running()) {
+            do_not_optimize(traj.mirror_fb());
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_mirror_fb, 100, 1000, 10000);
+
+    void tank_trajectory_retrace(State &state) {
+        TankDriveTrajectory traj = make_tank(state.get_arg());
+        while (state.keep_running()) {
+            do_not_optimize(traj.retrace());
+        }
+    }
+    RPF_BENCHMARK_ARGS(tank_trajectory_retrace, 100, 1000, 10000);
+} // namespace
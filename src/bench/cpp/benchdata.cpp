@@ -0,0 +1,32 @@
+#include "benchdata.h"
+#include "math/rpfmath.h"
+
+namespace rpf {
+    namespace bench {
+        std::vector<Waypoint> make_waypoints(int count) {
+            std::vector<Waypoint> waypoints;
+            waypoints.reserve(count);
+            for (int i = 0; i < count; i++) {
+                // Weave left and right while going forwards
+                waypoints.push_back(Waypoint(i % 2 ? 1.0 : 0.0, i * 1.5, pi / 2));
+            }
+            return waypoints;
+        }
+
+        TrajectoryParams make_params(int waypoints, int samples, bool tank, PathType type,
+                GeneratorType generator) {
+            TrajectoryParams params;
+            params.waypoints = make_waypoints(waypoints);
+            params.alpha = 2;
+            params.sample_count = samples;
+            params.is_tank = tank;
+            params.type = type;
+            params.generator = generator;
+            return params;
+        }
+
+        RobotSpecs make_specs() {
+            return RobotSpecs(5, 8, 0.6);
+        }
+    } // namespace bench
+} // namespace rpf
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "path/path.h"
+#include "robotspecs.h"
+#include "trajectoryparams.h"
+#include <vector>
+
+namespace rpf {
+    namespace bench {
+        // A smooth S-shaped path with the specified number of waypoints
+        std::vector<Waypoint> make_waypoints(int count);
+        // Parameters for a trajectory through make_waypoints(waypoints)
+        TrajectoryParams make_params(int waypoints, int samples, bool tank,
+                PathType type = PathType::QUINTIC_HERMITE,
+                GeneratorType generator = GeneratorType::TWO_PASS);
+        RobotSpecs make_specs();
+    } // namespace bench
+} // namespace rpf
@@ -0,0 +1,182 @@
+#include "benchmark.h"
+#include "util/instrumentation.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace rpf {
+    namespace bench {
+
+        namespace {
+            struct Benchmark {
+                std::string name;
+                int arg;
+                Function func;
+            };
+            struct Result {
+                std::string name;
+                std::uint64_t iterations;
+                // Per iteration, in nanoseconds
+                double time;
+                double items_per_second;
+            };
+
+            // Function-local so that it is constructed before the registrars use it
+            std::vector<Benchmark> &registry() {
+                static std::vector<Benchmark> benchmarks;
+                return benchmarks;
+            }
+
+            /*
+             * Runs a benchmark with more and more iterations until it takes at least min_time,
+             * then reports the last run.
+             */
+            Result run(const Benchmark &b, double min_time) {
+                std::uint64_t iterations = 1;
+                while (true) {
+                    State state(iterations, b.arg);
+                    b.func(state);
+                    double elapsed = state.get_elapsed();
+
+                    if (elapsed >= min_time || iterations >= 1000000000) {
+                        Result r;
+                        r.name = b.name;
+                        r.iterations = iterations;
+                        r.time = elapsed * 1e9 / iterations;
+                        r.items_per_second = state.get_items_processed() / elapsed;
+                        return r;
+                    }
+                    // Aim a bit past min_time, but grow by at most 10x at a time
+                    double scale = elapsed > 0 ? min_time * 1.4 / elapsed : 10;
+                    scale = std::min(std::max(scale, 2.0), 10.0);
+                    iterations = static_cast<std::uint64_t>(std::ceil(iterations * scale));
+                }
+            }
+
+            std::string escape(const std::string &str) {
+                std::string out;
+                for (char c : str) {
+                    if (c == '"' || c == '\\') {
+                        out += '\\';
+                    }
+                    out += c;
+                }
+                return out;
+            }
+
+            void write_json(std::ostream &out, const std::vector<Result> &results) {
+                char date[64];
+                std::time_t now = std::time(nullptr);
+                std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+                out << "{\n";
+                out << "  \"context\": {\n";
+                out << "    \"date\": \"" << date << "\",\n";
+                out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+                out << "    \"library_build_type\": \"release\",\n";
+#else
+                out << "    \"library_build_type\": \"debug\",\n";
+#endif
+                out << "    \"instrumentation\": " << (probes_enabled() ? "true" : "false")
+                    << "\n";
+                out << "  },\n";
+                out << "  \"benchmarks\": [\n";
+                for (std::size_t i = 0; i < results.size(); i++) {
+                    const Result &r = results[i];
+                    out << "    {\n";
+                    out << "      \"name\": \"" << escape(r.name) << "\",\n";
+                    out << "      \"iterations\": " << r.iterations << ",\n";
+                    out << "      \"real_time\": " << r.time << ",\n";
+                    if (r.items_per_second > 0) {
+                        out << "      \"items_per_second\": " << r.items_per_second << ",\n";
+                    }
+                    out << "      \"time_unit\": \"ns\"\n";
+                    out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+                }
+                out << "  ]\n";
+                out << "}\n";
+            }
+
+            void print_usage(const char *program) {
+                std::fprintf(stderr,
+                        "Usage: %s [--filter=<substring>] [--min_time=<seconds>] "
+                        "[--format=console|json] [--out=<file>]\n",
+                        program);
+            }
+        } // namespace
+
+        void register_benchmark(const std::string &name, int arg, Function func) {
+            registry().push_back(Benchmark{name, arg, func});
+        }
+    } // namespace bench
+} // namespace rpf
+
+int main(int argc, char **argv) {
+    using namespace rpf::bench;
+
+    std::string filter;
+    double min_time = 0.5;
+    bool json = false;
+    std::string out_file;
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            filter = arg + 9;
+        }
+        else if (std::strncmp(arg, "--min_time=", 11) == 0) {
+            min_time = std::atof(arg + 11);
+        }
+        else if (std::strcmp(arg, "--format=json") == 0) {
+            json = true;
+        }
+        else if (std::strcmp(arg, "--format=console") == 0) {
+            json = false;
+        }
+        else if (std::strncmp(arg, "--out=", 6) == 0) {
+            out_file = arg + 6;
+        }
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    if (!json) {
+        std::printf("%-48s %16s %14s\n", "Benchmark", "Time (ns)", "Iterations");
+    }
+    for (const auto &b : registry()) {
+        if (b.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(run(b, min_time));
+        if (!json) {
+            const Result &r = results.back();
+            std::printf("%-48s %16.1f %14llu\n", r.name.c_str(), r.time,
+                    static_cast<unsigned long long>(r.iterations));
+            std::fflush(stdout);
+        }
+    }
+
+    if (json) {
+        write_json(std::cout, results);
+    }
+    if (!out_file.empty()) {
+        std::ofstream out(out_file);
+        if (!out) {
+            std::fprintf(stderr, "Cannot open %s\n", out_file.c_str());
+            return 1;
+        }
+        write_json(out, results);
+    }
+    return 0;
+}
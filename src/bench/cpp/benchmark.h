@@ -0,0 +1,121 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string>
+
+/*
+ * A small self-contained benchmark framework, in the style of Google Benchmark.
+ *
+ * Benchmarks are functions that take a State, and run the code to be measured in a
+ * while (state.keep_running()) loop:
+ *
+ *     void bench_something(rpf::bench::State &state) {
+ *         // Setup, not timed
+ *         while (state.keep_running()) {
+ *             rpf::bench::do_not_optimize(something());
+ *         }
+ *     }
+ *     RPF_BENCHMARK(bench_something);
+ *
+ * Benchmarks that take an argument are registered once for every argument with
+ * RPF_BENCHMARK_ARGS(bench_something, 10, 100, 1000), and are named e.g. bench_something/100.
+ */
+namespace rpf {
+    namespace bench {
+        class State {
+        public:
+            State(std::uint64_t iterations, int arg)
+                    : iterations(iterations), remaining(iterations), arg(arg) {
+            }
+
+            // Returns true while there are iterations left to run
+            // The time between the first call and the last call is measured
+            inline bool keep_running() {
+                if (remaining == iterations) {
+                    start = Clock::now();
+                }
+                if (remaining-- > 0) {
+                    return true;
+                }
+                elapsed += Clock::now() - start;
+                return false;
+            }
+
+            // Excludes the time until resume_timing() from the measurement
+            // Useful for setup that has to be redone every iteration
+            inline void pause_timing() {
+                elapsed += Clock::now() - start;
+            }
+            inline void resume_timing() {
+                start = Clock::now();
+            }
+
+            // The argument the benchmark was registered with, or 0
+            inline int get_arg() const {
+                return arg;
+            }
+            inline std::uint64_t get_iterations() const {
+                return iterations;
+            }
+
+            // Sets the number of items processed by all iterations, which is reported as a rate
+            inline void set_items_processed(std::uint64_t items) {
+                items_processed = items;
+            }
+            inline std::uint64_t get_items_processed() const {
+                return items_processed;
+            }
+
+            // The measured time in seconds
+            inline double get_elapsed() const {
+                return std::chrono::duration<double>(elapsed).count();
+            }
+
+        protected:
+            using Clock = std::chrono::steady_clock;
+
+            std::uint64_t iterations, remaining;
+            int arg;
+            std::uint64_t items_processed = 0;
+            Clock::time_point start;
+            Clock::duration elapsed = Clock::duration::zero();
+        };
+
+        using Function = std::function<void(State &)>;
+
+        void register_benchmark(const std::string &name, int arg, Function func);
+
+        struct Registrar {
+            Registrar(const char *name, void (*func)(State &)) {
+                register_benchmark(name, 0, func);
+            }
+            Registrar(const char *name, void (*func)(State &), std::initializer_list<int> args) {
+                for (int arg : args) {
+                    register_benchmark(std::string(name) + "/" + std::to_string(arg), arg, func);
+                }
+            }
+        };
+
+        // Makes sure the compiler does not optimize away the computation of a value
+        template <typename T>
+        inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : "r,m"(value) : "memory");
+#else
+            static volatile const void *sink;
+            sink = &value;
+#endif
+        }
+    } // namespace bench
+} // namespace rpf
+
+#define RPF_BENCHMARK_CONCAT2(a, b) a##b
+#define RPF_BENCHMARK_CONCAT(a, b) RPF_BENCHMARK_CONCAT2(a, b)
+#define RPF_BENCHMARK(func)                                                                        \
+    static rpf::bench::Registrar RPF_BENCHMARK_CONCAT(rpf_benchmark_, __LINE__)(#func, func)
+#define RPF_BENCHMARK_ARGS(func, ...)                                                              \
+    static rpf::bench::Registrar RPF_BENCHMARK_CONCAT(rpf_benchmark_, __LINE__)(                  \
+            #func, func, {__VA_ARGS__})
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "follower/tankdrivefollower.h"
+#include "util/triplebuffer.h"
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+namespace rpf {
+    /*
+     * Runs a TankDriveFollower on a dedicated thread at a fixed frequency.
+     *
+     * On Linux, the thread sleeps with clock_nanosleep() until absolute deadlines, so the period
+     * does not drift with the time each iteration takes. The thread can also be given SCHED_FIFO
+     * priority and pinned to a CPU. On other platforms, std::this_thread::sleep_until() is used
+     * instead, and the priority and affinity settings are ignored.
+     *
+     * The sensors and motors can be native function pointers. If they are not set, the sensor
+     * readings are taken from the latest values passed to push_feedback(), and the motor outputs
+     * are made available through poll_command(). Both of these are lock-free, so the thread never
+     * waits on the code that fills them.
+     */
+    class RealTimeRunner {
+    public:
+        struct Feedback {
+            // NaN means the sensor is not present, same as in TankDriveFollower
+            double l_pos = std::numeric_limits<double>::quiet_NaN();
+            double r_pos = std::numeric_limits<double>::quiet_NaN();
+            double direction = std::numeric_limits<double>::quiet_NaN();
+        };
+        struct Command {
+            double left = 0, right = 0;
+            // The time of the iteration that computed this command
+            double timestamp = 0;
+        };
+
+        struct Callbacks {
+            // Reads the sensors into the Feedback; if null, push_feedback() is used instead
+            void (*read_sensors)(void *user, Feedback &feedback) = nullptr;
+            // Sets the motor outputs; if null, poll_command() is used instead
+            void (*set_motors)(void *user, double left, double right) = nullptr;
+            void *user = nullptr;
+        };
+
+        struct Config {
+            double frequency = 200;
+            // The SCHED_FIFO priority (1-99), or 0 to keep the default scheduling policy
+            int priority = 0;
+            // The CPU to pin the thread to, or -1 to let it run on any CPU
+            int cpu = -1;
+        };
+
+        // All times are in seconds
+        struct Statistics {
+            std::uint64_t iterations = 0;
+            // Iterations that did not finish before the next deadline
+            std::uint64_t overruns = 0;
+            // The jitter is how late each iteration woke up after its deadline
+            double mean_jitter = 0, max_jitter = 0;
+            double max_exec_time = 0;
+        };
+
+        RealTimeRunner(
+                std::shared_ptr<const TankDriveTrajectory> target, const TankDriveGains &gains);
+        RealTimeRunner(std::shared_ptr<const TankDriveTrajectory> target,
+                const TankDriveGains &gains, const Callbacks &callbacks);
+        ~RealTimeRunner();
+
+        RealTimeRunner(const RealTimeRunner &) = delete;
+        RealTimeRunner &operator=(const RealTimeRunner &) = delete;
+
+        // Starts the thread
+        // Throws std::invalid_argument if the frequency is not positive, and std::logic_error if
+        // the runner was already started
+        void start(const Config &config);
+        // Stops the thread and waits for it to exit
+        // The motors are set to 0 before the thread exits
+        void stop();
+
+        inline bool is_running() const {
+            return running.load(std::memory_order_acquire);
+        }
+        inline bool is_finished() const {
+            return finished.load(std::memory_order_acquire);
+        }
+        // Whether the priority and affinity in the config were applied
+        // Setting them usually needs extra permissions, and failing to do so does not stop the
+        // runner
+        inline bool is_realtime() const {
+            return realtime.load(std::memory_order_acquire);
+        }
+
+        // Only to be called by one thread at a time
+        inline void push_feedback(const Feedback &feedback) {
+            this->feedback.write(feedback);
+        }
+        // Only to be called by one thread at a time
+        // Returns true if there is a new command since the last call
+        inline bool poll_command(Command &command) {
+            return this->command.read(command);
+        }
+
+        Statistics get_statistics() const;
+
+        // Records the state of every iteration into the ring; see TankDriveFollower
+        // Throws std::logic_error if the runner is running
+        void set_telemetry(std::shared_ptr<TelemetryRing> telemetry);
+
+    protected:
+        void run(Config config);
+        void read_feedback(Feedback &feedback);
+        void write_command(double left, double right, double timestamp);
+
+        TankDriveFollower follower;
+        Callbacks callbacks;
+
+        TripleBuffer<Feedback> feedback;
+        TripleBuffer<Command> command;
+
+        std::thread thread;
+        std::atomic<bool> stop_requested{false};
+        std::atomic<bool> running{false}, finished{false}, realtime{false};
+
+        // Statistics, updated by the thread
+        // Times are stored in nanoseconds
+        std::atomic<std::uint64_t> iterations{0}, overruns{0};
+        std::atomic<std::int64_t> jitter_sum{0}, max_jitter{0}, max_exec_time{0};
+    };
+} // namespace rpf
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "follower/telemetry.h"
+#include "trajectory/tankdrivemoment.h"
+#include "trajectory/tankdrivetrajectory.h"
+#include <cstddef>
+#include <memory>
+
+namespace rpf {
+    /*
+     * The gains used by TankDriveFollower.
+     */
+    struct TankDriveGains {
+        TankDriveGains() {
+        }
+        TankDriveGains(double kv, double ka, double kp, double ki, double kd, double kdp)
+                : kv(kv), ka(ka), kp(kp), ki(ki), kd(kd), kdp(kdp) {
+        }
+
+        double kv = 0, ka = 0, kp = 0, ki = 0, kd = 0;
+        // Directional proportional gain
+        double kdp = 0;
+    };
+
+    /*
+     * The control law of the Java TankDriveFollower, for following a TankDriveTrajectory.
+     *
+     * The outputs are computed from feedforward (kV, kA), PID on the position of each wheel and
+     * a proportional term on the direction of the robot (kDP). Sensor readings are passed in
+     * directly; a reading of NaN means that the sensor is not present, which turns off the
+     * terms that need it. Both position readings have to be present for the PID terms to be
+     * used.
+     *
+     * The follower keeps a cursor into the moments of the trajectory, so finding the moment for
+     * each iteration only has to look at the moments after the last one.
+     *
+     * If a telemetry ring is set, the state of every iteration is also pushed into it, so that it
+     * can be logged at the full rate of the control loop by another thread.
+     */
+    class TankDriveFollower {
+    public:
+        TankDriveFollower(std::shared_ptr<const TankDriveTrajectory> target,
+                const TankDriveGains &gains)
+                : target(target), gains(gains) {
+        }
+
+        inline void set_gains(const TankDriveGains &gains) {
+            this->gains = gains;
+        }
+        inline const TankDriveGains &get_gains() const {
+            return gains;
+        }
+        inline std::shared_ptr<const TankDriveTrajectory> get_target() const {
+            return target;
+        }
+
+        // The follower is the only producer of the ring; set to null to stop recording
+        inline void set_telemetry(std::shared_ptr<TelemetryRing> telemetry) {
+            this->telemetry = telemetry;
+        }
+        inline std::shared_ptr<TelemetryRing> get_telemetry() const {
+            return telemetry;
+        }
+
+        // Resets the follower, using the readings as the starting point
+        void initialize(double timestamp, double l_pos, double r_pos, double direction);
+        // Runs one iteration of the control loop and stores the motor outputs in left and right
+        // Returns true if the trajectory has ended, in which case the outputs are not changed
+        bool run(double timestamp, double l_pos, double r_pos, double direction, double &left,
+                double &right);
+
+        inline const TankDriveMoment &last_moment() const {
+            return moment;
+        }
+
+        // The state of the last iteration
+        double l_err = 0, r_err = 0, dir_err = 0;
+        double l_err_int = 0, r_err_int = 0;
+        double l_deriv = 0, r_deriv = 0;
+        double l_out = 0, r_out = 0;
+
+    protected:
+        std::shared_ptr<const TankDriveTrajectory> target;
+        TankDriveGains gains;
+        std::shared_ptr<TelemetryRing> telemetry;
+
+        // The index of the moment that was used last
+        std::size_t cursor = 0;
+        TankDriveMoment moment;
+
+        double init_time = 0, last_time = 0;
+        double l_init_pos = 0, r_init_pos = 0, init_direction = 0;
+        double l_last_err = 0, r_last_err = 0;
+    };
+} // namespace rpf
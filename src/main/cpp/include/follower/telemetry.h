@@ -0,0 +1,22 @@
+#pragma once
+
+#include "util/spscring.h"
+
+namespace rpf {
+    /*
+     * The state of one iteration of a follower, for logging.
+     *
+     * The layout is read directly by the Java TelemetryBuffer, so the fields must stay in this
+     * order and all be doubles.
+     */
+    struct FollowerTelemetry {
+        // The timestamp passed to the follower, and the time into the trajectory
+        double timestamp, time;
+        double l_err, r_err, dir_err;
+        double l_err_int, r_err_int;
+        double l_deriv, r_deriv;
+        double l_out, r_out;
+    };
+
+    using TelemetryRing = SPSCRing<FollowerTelemetry>;
+} // namespace rpf
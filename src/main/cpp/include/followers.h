@@ -0,0 +1,5 @@
+#pragma once
+
+#include "follower/tankdrivefollower.h"
+#include "follower/telemetry.h"
+#include "follower/realtimerunner.h"
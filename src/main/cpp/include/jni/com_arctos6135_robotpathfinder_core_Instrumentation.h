@@ -0,0 +1,39 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_core_Instrumentation */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_core_Instrumentation
+#define _Included_com_arctos6135_robotpathfinder_core_Instrumentation
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_Instrumentation
+ * Method:    isEnabled
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_core_Instrumentation_isEnabled
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_Instrumentation
+ * Method:    snapshot
+ * Signature: ()[Lcom/arctos6135/robotpathfinder/core/Instrumentation$ProbeStats;
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_arctos6135_robotpathfinder_core_Instrumentation_snapshot
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_Instrumentation
+ * Method:    reset
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_Instrumentation_reset
+  (JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
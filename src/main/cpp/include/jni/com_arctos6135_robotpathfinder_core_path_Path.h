@@ -72,6 +72,46 @@ JNIEXPORT jobject JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_sec
 JNIEXPORT jobject JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_wheelsAt
   (JNIEnv *, jobject, jdouble);
 
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_path_Path
+ * Method:    curvatureAt
+ * Signature: (D)D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureAt
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_path_Path
+ * Method:    curvatureDerivAt
+ * Signature: (D)D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureDerivAt
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_path_Path
+ * Method:    curvaturesAt
+ * Signature: ([D)[D
+ */
+JNIEXPORT jdoubleArray JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvaturesAt
+  (JNIEnv *, jobject, jdoubleArray);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_path_Path
+ * Method:    curvatureDerivsAt
+ * Signature: ([D)[D
+ */
+JNIEXPORT jdoubleArray JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureDerivsAt
+  (JNIEnv *, jobject, jdoubleArray);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_path_Path
+ * Method:    curvatureBoundAt
+ * Signature: (D)D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureBoundAt
+  (JNIEnv *, jobject, jdouble);
+
 /*
  * Class:     com_arctos6135_robotpathfinder_core_path_Path
  * Method:    _computeLen
@@ -120,6 +160,14 @@ JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1mir
 JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1retrace
   (JNIEnv *, jobject);
 
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_path_Path
+ * Method:    _transformed
+ * Signature: (DDD)J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1transformed
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble);
+
 /*
  * Class:     com_arctos6135_robotpathfinder_core_path_Path
  * Method:    _updateWaypoints
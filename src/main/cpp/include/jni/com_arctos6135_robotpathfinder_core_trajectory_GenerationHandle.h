@@ -0,0 +1,71 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+#define _Included_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+ * Method:    _construct
+ * Signature: (ZDDDDDD[Lcom/arctos6135/robotpathfinder/core/Waypoint;DIII)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1construct
+  (JNIEnv *, jobject, jboolean, jdouble, jdouble, jdouble, jdouble, jdouble, jdouble, jobjectArray, jdouble, jint, jint, jint);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+ * Method:    _destroy
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1destroy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+ * Method:    _getStatus
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1getStatus
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+ * Method:    cancel
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle_cancel
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+ * Method:    _waitFor
+ * Signature: (D)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1waitFor
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+ * Method:    _getResult
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1getResult
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle
+ * Method:    onComplete
+ * Signature: (Ljava/lang/Runnable;)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle_onComplete
+  (JNIEnv *, jobject, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
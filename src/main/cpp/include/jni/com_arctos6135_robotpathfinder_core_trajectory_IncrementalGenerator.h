@@ -0,0 +1,79 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+#define _Included_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    _construct
+ * Signature: (ZZDDDDDD[Lcom/arctos6135/robotpathfinder/core/Waypoint;DIII)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1construct
+  (JNIEnv *, jobject, jboolean, jboolean, jdouble, jdouble, jdouble, jdouble, jdouble, jdouble, jobjectArray, jdouble, jint, jint, jint);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    _destroy
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1destroy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    _step
+ * Signature: (D)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1step
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    getProgress
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_getProgress
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    isDone
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_isDone
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    getAvailableCount
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_getAvailableCount
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    getAvailableTime
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_getAvailableTime
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator
+ * Method:    _getResult
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1getResult
+  (JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
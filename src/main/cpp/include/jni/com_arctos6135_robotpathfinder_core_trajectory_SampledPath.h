@@ -0,0 +1,39 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_core_trajectory_SampledPath */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_core_trajectory_SampledPath
+#define _Included_com_arctos6135_robotpathfinder_core_trajectory_SampledPath
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_SampledPath
+ * Method:    _construct
+ * Signature: ([Lcom/arctos6135/robotpathfinder/core/Waypoint;DIIIZD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_SampledPath__1construct
+  (JNIEnv *, jobject, jobjectArray, jdouble, jint, jint, jint, jboolean, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_SampledPath
+ * Method:    _destroy
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_SampledPath__1destroy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_SampledPath
+ * Method:    getLength
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_SampledPath_getLength
+  (JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
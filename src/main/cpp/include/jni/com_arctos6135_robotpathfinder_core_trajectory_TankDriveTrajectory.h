@@ -11,10 +11,18 @@ extern "C" {
 /*
  * Class:     com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory
  * Method:    _construct
- * Signature: (DDDZ[Lcom/arctos6135/robotpathfinder/core/Waypoint;DII)V
+ * Signature: (DDDDDDZ[Lcom/arctos6135/robotpathfinder/core/Waypoint;DIII)V
  */
 JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory__1construct
-  (JNIEnv *, jobject, jdouble, jdouble, jdouble, jboolean, jobjectArray, jdouble, jint, jint);
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble, jdouble, jdouble, jdouble, jboolean, jobjectArray, jdouble, jint, jint, jint);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory
+ * Method:    _constructSampled
+ * Signature: (Lcom/arctos6135/robotpathfinder/core/trajectory/SampledPath;DDDDDD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory__1constructSampled
+  (JNIEnv *, jobject, jobject, jdouble, jdouble, jdouble, jdouble, jdouble, jdouble);
 
 /*
  * Class:     com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory
@@ -96,6 +104,38 @@ JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_Tank
 JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory__1retrace
   (JNIEnv *, jobject);
 
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory
+ * Method:    _timeScaled
+ * Signature: (D)J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory__1timeScaled
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory
+ * Method:    _transformed
+ * Signature: (DDD)J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory__1transformed
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory
+ * Method:    _anchoredAt
+ * Signature: (DDD)J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory__1anchoredAt
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory
+ * Method:    _subtrajectory
+ * Signature: (DD)J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_TankDriveTrajectory__1subtrajectory
+  (JNIEnv *, jobject, jdouble, jdouble);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,103 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+#define _Included_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    _construct
+ * Signature: (Lcom/arctos6135/robotpathfinder/core/trajectory/TankDriveTrajectory;DDDDDD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1construct
+  (JNIEnv *, jobject, jobject, jdouble, jdouble, jdouble, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    _destroy
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1destroy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    _start
+ * Signature: (DII)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1start
+  (JNIEnv *, jobject, jdouble, jint, jint);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    stop
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_stop
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    isRunning
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_isRunning
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    isFinished
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_isFinished
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    isRealTime
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_isRealTime
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    pushFeedback
+ * Signature: (DDD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_pushFeedback
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    pollCommand
+ * Signature: ([D)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_pollCommand
+  (JNIEnv *, jobject, jdoubleArray);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    getStatistics
+ * Signature: ()Lcom/arctos6135/robotpathfinder/follower/RealTimeFollowerRunner$Statistics;
+ */
+JNIEXPORT jobject JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_getStatistics
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner
+ * Method:    _setTelemetry
+ * Signature: (Lcom/arctos6135/robotpathfinder/follower/TelemetryBuffer;)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1setTelemetry
+  (JNIEnv *, jobject, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
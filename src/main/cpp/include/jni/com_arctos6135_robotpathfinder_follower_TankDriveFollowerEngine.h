@@ -0,0 +1,143 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+#define _Included_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    _construct
+ * Signature: (Lcom/arctos6135/robotpathfinder/core/trajectory/TankDriveTrajectory;DDDDDD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1construct
+  (JNIEnv *, jobject, jobject, jdouble, jdouble, jdouble, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    _destroy
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1destroy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    _setGains
+ * Signature: (DDDDDD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1setGains
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    initialize
+ * Signature: (DDDD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_initialize
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    run
+ * Signature: (DDDD[D)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_run
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble, jdouble, jdoubleArray);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastMoment
+ * Signature: ()Lcom/arctos6135/robotpathfinder/core/trajectory/TankDriveMoment;
+ */
+JNIEXPORT jobject JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastMoment
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastLeftError
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftError
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastRightError
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightError
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastDirectionalError
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastDirectionalError
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastLeftIntegral
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftIntegral
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastRightIntegral
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightIntegral
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastLeftDerivative
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftDerivative
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastRightDerivative
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightDerivative
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastLeftOutput
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftOutput
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    lastRightOutput
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightOutput
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine
+ * Method:    _setTelemetry
+ * Signature: (Lcom/arctos6135/robotpathfinder/follower/TelemetryBuffer;)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1setTelemetry
+  (JNIEnv *, jobject, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
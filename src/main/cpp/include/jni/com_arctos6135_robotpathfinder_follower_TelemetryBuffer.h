@@ -0,0 +1,63 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_follower_TelemetryBuffer */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+#define _Included_com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+ * Method:    _construct
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer__1construct
+  (JNIEnv *, jobject, jint);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+ * Method:    _destroy
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer__1destroy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+ * Method:    _drain
+ * Signature: (Ljava/nio/ByteBuffer;II)I
+ */
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer__1drain
+  (JNIEnv *, jobject, jobject, jint, jint);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+ * Method:    size
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer_size
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+ * Method:    capacity
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer_capacity
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_follower_TelemetryBuffer
+ * Method:    dropped
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer_dropped
+  (JNIEnv *, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
@@ -0,0 +1,95 @@
+// clang-format off
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile */
+
+#ifndef _Included_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+#define _Included_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    _construct
+ * Signature: (DDDD)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile__1construct
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    _destroy
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile__1destroy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    _copy
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile__1copy
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    totalTime
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_totalTime
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    isReversed
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_isReversed
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    position
+ * Signature: (D)D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_position
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    velocity
+ * Signature: (D)D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_velocity
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    acceleration
+ * Signature: (D)D
+ */
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_acceleration
+  (JNIEnv *, jobject, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    update
+ * Signature: (DDDD)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_update
+  (JNIEnv *, jobject, jdouble, jdouble, jdouble, jdouble);
+
+/*
+ * Class:     com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile
+ * Method:    sample
+ * Signature: ([D[D[D[D)V
+ */
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_sample
+  (JNIEnv *, jobject, jdoubleArray, jdoubleArray, jdoubleArray, jdoubleArray);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+// clang-format on
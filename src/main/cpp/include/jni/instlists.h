@@ -1,3 +1,5 @@
+#include "followers.h"
+#include "motionprofiles.h"
 #include "trajectories.h"
 #include <list>
 #include <memory>
@@ -6,7 +8,21 @@
 extern std::list<std::shared_ptr<rpf::Path>> pinstances;
 extern std::list<std::shared_ptr<rpf::BasicTrajectory>> btinstances;
 extern std::list<std::shared_ptr<rpf::TankDriveTrajectory>> ttinstances;
+extern std::list<std::shared_ptr<rpf::TrapezoidalMotionProfile>> tmpinstances;
+extern std::list<std::shared_ptr<rpf::TankDriveFollower>> tdfinstances;
+extern std::list<std::shared_ptr<rpf::RealTimeRunner>> rtrinstances;
+extern std::list<std::shared_ptr<rpf::TelemetryRing>> telinstances;
+extern std::list<std::shared_ptr<rpf::GenerationJob>> gjinstances;
+extern std::list<std::shared_ptr<rpf::IncrementalGenerator>> iginstances;
+extern std::list<std::shared_ptr<rpf::SampledPath>> spinstances;
 
 extern std::mutex pinstances_mutex;
 extern std::mutex btinstances_mutex;
 extern std::mutex ttinstances_mutex;
+extern std::mutex tmpinstances_mutex;
+extern std::mutex tdfinstances_mutex;
+extern std::mutex rtrinstances_mutex;
+extern std::mutex telinstances_mutex;
+extern std::mutex gjinstances_mutex;
+extern std::mutex iginstances_mutex;
+extern std::mutex spinstances_mutex;
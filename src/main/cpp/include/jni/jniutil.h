@@ -1,10 +1,7 @@
 #pragma once
 
-#include <algorithm>
+#include "util/instancelist.h"
 #include <jni.h>
-#include <list>
-#include <memory>
-#include <mutex>
 
 namespace rpf {
     template <typename T>
@@ -37,33 +34,9 @@ namespace rpf {
     template <>
     jdouble get_field<jdouble>(JNIEnv *env, jobject obj, const char *fname);
 
-    template <typename T>
-    bool remove_instance(
-            std::list<std::shared_ptr<T>> &instances, std::mutex &instances_mutex, T *ptr) {
-        // Acquire lock to the mutex
-        std::lock_guard<std::mutex> lock(instances_mutex);
-        auto it = std::find_if(
-                instances.begin(), instances.end(), [&](const auto &p) { return p.get() == ptr; });
-        if (it != instances.end()) {
-            instances.erase(it);
-            return true;
-        }
-        else {
-            return false;
-        }
-    }
-    template <typename T>
-    bool check_instance(
-            std::list<std::shared_ptr<T>> &instances, std::mutex &instances_mutex, T *ptr) {
-        // Acquire lock to the mutex
-        std::lock_guard<std::mutex> lock(instances_mutex);
-        auto it = std::find_if(
-                instances.begin(), instances.end(), [&](const auto &p) { return p.get() == ptr; });
-        return it != instances.end();
-    }
-
     constexpr const char * const EX_IllegalStateException = "java/lang/IllegalStateException";
     constexpr const char * const EX_IllegalArgumentException = "java/lang/IllegalArgumentException";
+    constexpr const char * const EX_CancellationException = "java/util/concurrent/CancellationException";
     constexpr const char * const EX_TrajectoryGenerationException = "com/arctos6135/robotpathfinder/core/trajectory/TrajectoryGenerationException";
 
     void throw_exception(JNIEnv *env, const char *ex, const char *msg);
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "math/vec2d.h"
+#include "waypoint.h"
+#include <cmath>
+
+namespace rpf {
+    /*
+     * A rotation about the origin, followed by a translation.
+     *
+     * Lengths, curvatures and timing are all unchanged by a rigid transform, so a path or
+     * trajectory can be moved somewhere else by only transforming the positions and headings it
+     * returns, without generating it again.
+     */
+    struct RigidTransform {
+        // The identity
+        RigidTransform() : translation(0, 0), rotation(0), c(1), s(0) {
+        }
+        RigidTransform(const Vec2D &translation, double rotation)
+                : translation(translation), rotation(rotation), c(std::cos(rotation)),
+                  s(std::sin(rotation)) {
+        }
+
+        // The transform that moves the pose from to the pose to
+        // e.g. to move a trajectory that was planned to start at from to where the robot really is
+        static RigidTransform between(const Waypoint &from, const Waypoint &to);
+
+        // This transform followed by next
+        RigidTransform then(const RigidTransform &next) const;
+
+        inline bool is_identity() const {
+            return rotation == 0 && translation.x == 0 && translation.y == 0;
+        }
+
+        // Transforms a position
+        inline Vec2D apply(const Vec2D &v) const {
+            return Vec2D(c * v.x - s * v.y + translation.x, s * v.x + c * v.y + translation.y);
+        }
+        // Transforms a direction, e.g. a derivative, which is only rotated
+        inline Vec2D rotate(const Vec2D &v) const {
+            return Vec2D(c * v.x - s * v.y, s * v.x + c * v.y);
+        }
+        // Transforms a heading
+        double apply_angle(double angle) const;
+
+        Vec2D translation;
+        double rotation;
+
+    protected:
+        // The cos and sin of the rotation
+        double c, s;
+    };
+} // namespace rpf
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "vec2d.h"
+#include <cmath>
 
 namespace rpf {
     /* RobotPathfinder Math */
 
     // Linear Interpolation
-    double lerp(double a, double b, double f);
+    inline double lerp(double a, double b, double f) {
+        return (a * (1.0 - f)) + (b * f);
+    }
     // Restrict Angle
     double restrict_angle(double angle);
     // Mirror Angle
@@ -14,10 +17,17 @@ namespace rpf {
     // Linearly interpolates between angles
     double lerp_angle(double a, double b, double f);
     double lerp_angle(Vec2D a, Vec2D b, double f);
+    // Finds the smaller difference from one angle to another
+    double angle_diff(double src, double target);
     // Restrict absolute value
     double restrict_abs(double x, double m);
     // Computes curvature
-    double curvature(double dx, double ddx, double dy, double ddy);
+    inline double curvature(double dx, double ddx, double dy, double ddy) {
+        double m = dx * dx + dy * dy;
+        return (dx * ddy - dy * ddx) / (m * std::sqrt(m));
+    }
+    // Computes the derivative of curvature with respect to distance
+    double curvature_deriv(const Vec2D &d, const Vec2D &dd, const Vec2D &ddd);
     // The constant pi
     constexpr double pi = 3.141592653589793238462643383279502884;
 } // namespace rpf
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cmath>
+
 namespace rpf {
     struct Vec2D {
         Vec2D(double x, double y) : x(x), y(y) {
@@ -7,22 +9,56 @@ namespace rpf {
         Vec2D() : x(0), y(0) {
         }
 
-        double dist(const Vec2D &) const;
+        // The arithmetic is defined here so that it can be inlined into the path and trajectory
+        // kernels
+        inline double dist(const Vec2D &other) const {
+            return std::sqrt((x - other.x) * (x - other.x) + (y - other.y) * (y - other.y));
+        }
         void normalize();
-        double magnitude() const;
-        double dot(const Vec2D &) const;
+        inline double magnitude() const {
+            return std::sqrt(x * x + y * y);
+        }
+        inline double dot(const Vec2D &other) const {
+            return x * other.x + y * other.y;
+        }
         Vec2D proj(const Vec2D &) const;
         Vec2D reflect(const Vec2D &) const;
 
-        Vec2D operator+(const Vec2D &) const;
-        Vec2D &operator+=(const Vec2D &);
-        Vec2D operator-(const Vec2D &) const;
-        Vec2D &operator-=(const Vec2D &);
-        Vec2D operator*(double) const;
-        Vec2D &operator*=(double);
-        friend Vec2D operator*(double, const Vec2D &);
-        Vec2D operator/(double) const;
-        Vec2D &operator/=(double);
+        inline Vec2D operator+(const Vec2D &other) const {
+            return Vec2D(x + other.x, y + other.y);
+        }
+        inline Vec2D &operator+=(const Vec2D &other) {
+            x += other.x;
+            y += other.y;
+            return *this;
+        }
+        inline Vec2D operator-(const Vec2D &other) const {
+            return Vec2D(x - other.x, y - other.y);
+        }
+        inline Vec2D &operator-=(const Vec2D &other) {
+            x -= other.x;
+            y -= other.y;
+            return *this;
+        }
+        inline Vec2D operator*(double scalar) const {
+            return Vec2D(x * scalar, y * scalar);
+        }
+        inline Vec2D &operator*=(double scalar) {
+            x *= scalar;
+            y *= scalar;
+            return *this;
+        }
+        friend inline Vec2D operator*(double scalar, const Vec2D &vec) {
+            return Vec2D(vec.x * scalar, vec.y * scalar);
+        }
+        inline Vec2D operator/(double scalar) const {
+            return Vec2D(x / scalar, y / scalar);
+        }
+        inline Vec2D &operator/=(double scalar) {
+            x /= scalar;
+            y /= scalar;
+            return *this;
+        }
 
         static Vec2D lerp(const Vec2D &, const Vec2D &, double);
 
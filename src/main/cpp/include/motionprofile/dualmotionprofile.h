@@ -0,0 +1,76 @@
+#pragma once
+
+#include "motionprofile/motionprofile.h"
+#include <algorithm>
+#include <type_traits>
+
+namespace rpf {
+    /*
+     * A pair of motion profiles, one for the left wheel and one for the right wheel.
+     *
+     * The profiles are stored by value, so T has to be a concrete motion profile type.
+     */
+    template <typename T>
+    class DualMotionProfile {
+        static_assert(std::is_base_of<MotionProfile, T>::value, "T must be a MotionProfile");
+
+    public:
+        DualMotionProfile(const T &left, const T &right) : left(left), right(right) {
+        }
+
+        // The greater of the two total times
+        inline double total_time() const {
+            return std::max(left.total_time(), right.total_time());
+        }
+        // Only true if both profiles are reversed
+        inline bool is_reversed() const {
+            return left.is_reversed() && right.is_reversed();
+        }
+
+        inline T &get_left() {
+            return left;
+        }
+        inline const T &get_left() const {
+            return left;
+        }
+        inline T &get_right() {
+            return right;
+        }
+        inline const T &get_right() const {
+            return right;
+        }
+
+        // Gets the position, velocity and acceleration of both wheels at once
+        inline void sample(double t, double &lpos, double &rpos, double &lvel, double &rvel,
+                double &laccel, double &raccel) const {
+            left.sample(t, lpos, lvel, laccel);
+            right.sample(t, rpos, rvel, raccel);
+        }
+
+    protected:
+        T left, right;
+    };
+
+    /*
+     * A DualMotionProfile of dynamic motion profiles, which can update each wheel's profile.
+     */
+    template <typename T>
+    class DynamicDualMotionProfile : public DualMotionProfile<T> {
+        static_assert(std::is_base_of<DynamicMotionProfile, T>::value,
+                "T must be a DynamicMotionProfile");
+
+    public:
+        DynamicDualMotionProfile(const T &left, const T &right)
+                : DualMotionProfile<T>(left, right) {
+        }
+
+        inline bool update_left(double current_time, double current_pos, double current_vel,
+                double current_accel) {
+            return this->left.update(current_time, current_pos, current_vel, current_accel);
+        }
+        inline bool update_right(double current_time, double current_pos, double current_vel,
+                double current_accel) {
+            return this->right.update(current_time, current_pos, current_vel, current_accel);
+        }
+    };
+} // namespace rpf
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+
+namespace rpf {
+    /*
+     * The basic requirements for a motion profile.
+     *
+     * Motion profiles provide the position, velocity and acceleration of the robot along a
+     * straight line for any given time.
+     */
+    class MotionProfile {
+    public:
+        virtual ~MotionProfile() {
+        }
+
+        virtual double total_time() const = 0;
+        virtual double position(double t) const = 0;
+        virtual double velocity(double t) const = 0;
+        virtual double acceleration(double t) const = 0;
+        virtual bool is_reversed() const = 0;
+
+        // Gets the position, velocity and acceleration at the same time
+        // Subclasses can override this to avoid finding the part of the profile three times
+        virtual void sample(double t, double &pos, double &vel, double &accel) const {
+            pos = position(t);
+            vel = velocity(t);
+            accel = acceleration(t);
+        }
+        // Samples the profile at count times
+        // Any of the output arrays may be null if the values are not needed
+        void sample(const double *t, std::size_t count, double *pos, double *vel,
+                double *accel) const;
+    };
+
+    /*
+     * A motion profile that can be re-generated to match the real life conditions of the robot.
+     *
+     * update() returns true if the updated profile has to overshoot the original target.
+     */
+    class DynamicMotionProfile : public MotionProfile {
+    public:
+        virtual bool update(double current_time, double current_pos, double current_vel,
+                double current_accel) = 0;
+    };
+} // namespace rpf
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "math/rpfmath.h"
+#include "motionprofile/dualmotionprofile.h"
+#include "motionprofile/trapezoidalmotionprofile.h"
+#include "robotspecs.h"
+#include "trajectory/tankdrivemoment.h"
+
+namespace rpf {
+    /*
+     * A tank drive robot turning in place.
+     *
+     * The wheels follow trapezoidal profiles in opposite directions, each covering an arc of
+     * angle * base_width / 2. Everything is computed directly from the profiles, so there is no
+     * path and no sampling involved.
+     *
+     * This is a port of the Java TrapezoidalTankDriveRotationProfile.
+     */
+    class TankDriveRotationProfile : public DualMotionProfile<TrapezoidalMotionProfile> {
+    public:
+        TankDriveRotationProfile(
+                const RobotSpecs &specs, double angle, double init_facing = pi / 2);
+
+        // Times outside of the profile are clamped to the start or the end
+        TankDriveMoment get(double t) const;
+
+        inline const RobotSpecs &get_specs() const {
+            return left.get_specs();
+        }
+        inline double get_angle() const {
+            return angle;
+        }
+        inline double get_init_facing() const {
+            return init_facing;
+        }
+
+    protected:
+        double angle;
+        double init_facing;
+    };
+} // namespace rpf
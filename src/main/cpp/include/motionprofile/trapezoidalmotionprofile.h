@@ -0,0 +1,66 @@
+#pragma once
+
+#include "motionprofile/motionprofile.h"
+#include "robotspecs.h"
+
+namespace rpf {
+    /*
+     * A trapezoidal motion profile, in which the velocity and acceleration are limited but the
+     * jerk is not.
+     *
+     * This is a port of the Java TrapezoidalMotionProfile and behaves the same way. Times passed
+     * to the query methods are absolute, so after an update() they must be no less than the time
+     * of the update.
+     */
+    class TrapezoidalMotionProfile : public DynamicMotionProfile {
+    public:
+        TrapezoidalMotionProfile(const RobotSpecs &specs, double dist, double init_vel = 0);
+
+        inline double total_time() const override {
+            // Add init_time to get the absolute time
+            return t_total + init_time;
+        }
+        inline bool is_reversed() const override {
+            return reverse;
+        }
+
+        double position(double t) const override;
+        double velocity(double t) const override;
+        double acceleration(double t) const override;
+        void sample(double t, double &pos, double &vel, double &accel) const override;
+        using MotionProfile::sample;
+
+        bool update(double current_time, double current_pos, double current_vel,
+                double current_accel) override;
+
+        inline const RobotSpecs &get_specs() const {
+            return specs;
+        }
+
+    protected:
+        // Used by the constructor and update()
+        // Returns whether the profile overshoots
+        bool construct(double dist, double init_vel);
+
+        // The parts of the profile
+        enum class Phase { ACCEL, CRUISE, DECEL };
+        // Finds the part of the profile t is in, and changes t to be relative to the start of the
+        // profile
+        // Throws std::out_of_range if t is out of range
+        Phase phase_at(double &t) const;
+
+        RobotSpecs specs;
+
+        double init_vel = 0;
+        double init_dist = 0, init_time = 0;
+
+        double distance;
+        double max_acl, max_vel;
+        double cruise_vel;
+
+        double t_accel, t_cruise, t_total;
+        double accel_dist, cruise_dist;
+
+        bool reverse = false;
+    };
+} // namespace rpf
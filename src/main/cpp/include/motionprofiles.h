@@ -0,0 +1,6 @@
+#pragma once
+
+#include "motionprofile/dualmotionprofile.h"
+#include "motionprofile/motionprofile.h"
+#include "motionprofile/tankdriverotationprofile.h"
+#include "motionprofile/trapezoidalmotionprofile.h"
@@ -1,10 +1,12 @@
 #pragma once
 
+#include "math/rigidtransform.h"
 #include "segments.h"
 #include "waypoint.h"
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -13,6 +15,26 @@ namespace rpf {
         BEZIER = 1,
         CUBIC_HERMITE = 2,
         QUINTIC_HERMITE = 3,
+        // Quintic hermite with second derivatives solved for minimum jerk
+        QUINTIC_HERMITE_C2 = 4,
+        CLOTHOID = 5,
+    };
+
+    // Everything about a point on a path that the trajectory generators need
+    struct PathSample {
+        Vec2D pos;
+        // The unit tangent, i.e. (cos(heading), sin(heading))
+        Vec2D tangent;
+        double heading;
+        double curvature;
+        // The positions of the left and right wheels
+        Vec2D left, right;
+    };
+
+    // Carries a segment type as a value, to pass it to generic lambdas
+    template <typename Segment>
+    struct SegmentTag {
+        using type = Segment;
     };
 
     class Path {
@@ -26,18 +48,41 @@ namespace rpf {
             return base_radius;
         }
 
+        // The positions, derivatives and wheels are transformed if the path is (see transformed())
         Vec2D at(double) const;
         Vec2D deriv_at(double) const;
         Vec2D second_deriv_at(double) const;
         std::pair<Vec2D, Vec2D> wheels_at(double) const;
+        // Finds the positions of the wheels given the position and derivative of the path
+        std::pair<Vec2D, Vec2D> wheels_at(const Vec2D &pos, const Vec2D &deriv) const;
+
+        double curvature_at(double) const;
+        // The derivative of the curvature with respect to distance
+        double curvature_deriv_at(double) const;
+        // Batched versions of the above, which write the values at every t into out
+        void curvature_at(const std::vector<double> &t, std::vector<double> &out) const;
+        void curvature_deriv_at(const std::vector<double> &t, std::vector<double> &out) const;
+        void wheels_at(
+                const std::vector<double> &t, std::vector<std::pair<Vec2D, Vec2D>> &out) const;
+        // Returns an upper bound on the absolute curvature of the segment that contains t
+        double curvature_bound_at(double) const;
 
         double compute_len(int);
+        // Same as compute_len(int), but only computes the lookup table entries for the points in
+        // [begin, end), so that the work can be split up across several calls
+        // The calls have to cover all the points in order, and each returns the length so far
+        // The lookup table is shared with the transformed copies of the path, so this must only be
+        // called before any are made
+        double compute_len(int points, int begin, int end);
 
         inline double get_len() const {
             return total_len;
         }
 
         double s2t(double) const;
+        // Same as s2t(double), but walks forwards from the lookup table entry at cursor and
+        // updates it, so that increasing values of s take constant time
+        double s2t(double s, std::size_t &cursor) const;
         double t2s(double) const;
 
         inline double get_alpha() const {
@@ -63,16 +108,151 @@ namespace rpf {
         std::shared_ptr<Path> mirror_lr() const;
         std::shared_ptr<Path> retrace() const;
 
+        /*
+         * Gets a copy of this path moved by transform, after any transform it already has.
+         *
+         * The copy shares the segments and the length lookup table with this path, so nothing is
+         * generated again. Only the positions and derivatives it returns and its waypoints are
+         * transformed, since the lengths and curvatures are the same.
+         */
+        std::shared_ptr<Path> transformed(const RigidTransform &transform) const;
+        inline const RigidTransform &get_transform() const {
+            return transform;
+        }
+
+        // The segments are not transformed
+        inline const std::vector<std::unique_ptr<SplineSegment>> &get_segments() const {
+            return *segments;
+        }
+
+        /*
+         * Calls func with a SegmentTag for the type of the segments of this path, and returns the
+         * result.
+         *
+         * This is the one place where the path type is switched on. Code that evaluates the path
+         * many times should do it inside func with a PathEvaluator, so that every evaluation is
+         * inlined instead of being a virtual call.
+         */
+        template <typename Func>
+        auto visit(Func &&func) const -> decltype(func(SegmentTag<QuinticSegment>())) {
+            switch (type) {
+            case PathType::BEZIER:
+                return func(SegmentTag<BezierSegment>());
+            case PathType::CUBIC_HERMITE:
+                return func(SegmentTag<CubicSegment>());
+            case PathType::QUINTIC_HERMITE:
+            case PathType::QUINTIC_HERMITE_C2:
+                return func(SegmentTag<QuinticSegment>());
+            case PathType::CLOTHOID:
+                return func(SegmentTag<ClothoidSegment>());
+            default:
+                throw std::invalid_argument("Invalid path type");
+            }
+        }
+
     protected:
+        // Finds the segment that contains t, and the value of t within that segment
+        const SplineSegment &segment_at(double t, double &seg_t) const;
+        // Reflects v about the line in the direction ref through the origin of the path, which is
+        // moved along with it when it is transformed
+        Vec2D reflect(const Vec2D &v, const Vec2D &ref) const;
+
         std::vector<Waypoint> waypoints;
         double alpha;
-        std::vector<std::unique_ptr<SplineSegment>> segments;
+        // The segments, curvature bounds and lookup table are shared with the transformed copies
+        std::shared_ptr<std::vector<std::unique_ptr<SplineSegment>>> segments =
+                std::make_shared<std::vector<std::unique_ptr<SplineSegment>>>();
+        // The max curvature of each segment
+        std::shared_ptr<std::vector<double>> curvature_bounds =
+                std::make_shared<std::vector<double>>();
         PathType type;
 
         double total_len = std::numeric_limits<double>::quiet_NaN();
-        std::vector<std::pair<double, double>> s2t_table;
+        std::shared_ptr<std::vector<std::pair<double, double>>> s2t_table =
+                std::make_shared<std::vector<std::pair<double, double>>>();
+        RigidTransform transform;
 
         bool backwards = false;
-        double base_radius;
+        double base_radius = 0;
+    };
+
+    /*
+     * Evaluates a path whose segments are all of the type Segment, without virtual calls.
+     *
+     * The results are the same as the methods of the same name in Path, except that the transform
+     * of the path is not applied. Get one with Path::visit(), which makes sure that the segment
+     * type is right.
+     */
+    template <typename Segment>
+    class PathEvaluator {
+    public:
+        explicit PathEvaluator(const Path &path)
+                : path(path), segments(path.get_segments()), count(segments.size()) {
+        }
+
+        inline Vec2D at(double t) const {
+            double seg_t;
+            const Segment &segment = segment_at(t, seg_t);
+            return segment.at(seg_t);
+        }
+        inline Vec2D deriv_at(double t) const {
+            double seg_t;
+            const Segment &segment = segment_at(t, seg_t);
+            return segment.deriv_at(seg_t);
+        }
+        inline Vec2D second_deriv_at(double t) const {
+            double seg_t;
+            const Segment &segment = segment_at(t, seg_t);
+            return segment.second_deriv_at(seg_t);
+        }
+        inline Vec2D third_deriv_at(double t) const {
+            double seg_t;
+            const Segment &segment = segment_at(t, seg_t);
+            return segment.third_deriv_at(seg_t);
+        }
+        inline std::pair<Vec2D, Vec2D> wheels_at(double t) const {
+            double seg_t;
+            const Segment &segment = segment_at(t, seg_t);
+            return path.wheels_at(segment.at(seg_t), segment.deriv_at(seg_t));
+        }
+
+        // Computes everything in PathSample at t with one segment lookup and evaluation
+        // Instead of taking the sin and cos of the heading, the wheels are offset along the
+        // normalized derivative
+        inline void sample(double t, PathSample &out) const {
+            double seg_t;
+            const Segment &segment = segment_at(t, seg_t);
+            Vec2D d, dd;
+            segment.derivs_at(seg_t, out.pos, d, dd);
+
+            double speed2 = d.x * d.x + d.y * d.y;
+            double speed = std::sqrt(speed2);
+            out.tangent = d / speed;
+            out.heading = std::atan2(d.y, d.x);
+            out.curvature = (d.x * dd.y - d.y * dd.x) / (speed2 * speed);
+
+            // The left wheel is on the left of the direction of travel
+            double b = path.get_backwards() ? -path.get_base() : path.get_base();
+            Vec2D offset(-out.tangent.y * b, out.tangent.x * b);
+            out.left = out.pos + offset;
+            out.right = out.pos - offset;
+        }
+
+        // Finds the segment that contains t, and the value of t within that segment
+        inline const Segment &segment_at(double t, double &seg_t) const {
+            if (t >= 1) {
+                seg_t = 1;
+                return static_cast<const Segment &>(*segments[count - 1]);
+            }
+            t *= count;
+            double i = std::floor(t);
+            seg_t = t - i;
+            return static_cast<const Segment &>(*segments[static_cast<std::size_t>(i)]);
+        }
+
+    protected:
+        const Path &path;
+        const std::vector<std::unique_ptr<SplineSegment>> &segments;
+        std::size_t count;
     };
 } // namespace rpf
@@ -15,5 +15,10 @@ namespace rpf {
 
         double max_v, max_a;
         double base_width;
+        // Optional voltage limit for each side of the robot, using the feedforward model
+        // voltage = kv * velocity + ka * acceleration
+        // Disabled if max_voltage is NaN
+        double max_voltage = std::numeric_limits<double>::quiet_NaN();
+        double kv = 0, ka = 0;
     };
 } // namespace rpf
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "splinesegment.h"
+#include <cmath>
+
+namespace rpf {
+    /*
+     * A clothoid (Euler spiral) segment, whose curvature changes linearly with distance.
+     *
+     * The segment is fitted to the positions and headings at its two ends (G1 Hermite
+     * interpolation). It is parameterized by the fraction of its length, so the magnitude of the
+     * derivative is always equal to the length of the segment.
+     */
+    class ClothoidSegment final : public SplineSegment {
+    public:
+        ClothoidSegment(const Vec2D &p0, const Vec2D &p1, double heading0, double heading1);
+
+        Vec2D at(double) const override;
+        Vec2D deriv_at(double) const override;
+        Vec2D second_deriv_at(double) const override;
+        Vec2D third_deriv_at(double) const override;
+
+        // Evaluates the position and the first two derivatives at t, with only one sin and cos
+        inline void derivs_at(double t, Vec2D &pos, Vec2D &deriv, Vec2D &second_deriv) const {
+            double theta = heading_at(t);
+            Vec2D tangent(std::cos(theta), std::sin(theta));
+            pos = at(t);
+            deriv = tangent * len;
+            second_deriv = Vec2D(-tangent.y, tangent.x) * (len * (dtheta + 2 * ddtheta * t));
+        }
+
+        double max_curvature() const override;
+
+        inline double get_len() const {
+            return len;
+        }
+
+    protected:
+        // The heading at t is theta0 + dtheta * t + ddtheta * t^2
+        inline double heading_at(double t) const {
+            return theta0 + (dtheta + ddtheta * t) * t;
+        }
+        // Integrates the unit tangent from t0 to t1
+        Vec2D integrate(double t0, double t1) const;
+
+        static constexpr int TABLE_SIZE = 16;
+
+        double theta0, dtheta, ddtheta;
+        double len;
+        // The positions at every 1 / TABLE_SIZE of the segment
+        // at() only has to integrate from the closest of these
+        Vec2D table[TABLE_SIZE + 1];
+    };
+} // namespace rpf
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "splinesegment.h"
+
+namespace rpf {
+    namespace detail {
+        // deriv_factors[d][i] is the factor i! / (i - d)! that the coefficient of t^i is
+        // multiplied by in the d-th derivative, or 0 if the term vanishes
+        constexpr double deriv_factors[4][6] = {
+                {1, 1, 1, 1, 1, 1},
+                {0, 1, 2, 3, 4, 5},
+                {0, 0, 2, 6, 12, 20},
+                {0, 0, 0, 6, 24, 60},
+        };
+    } // namespace detail
+
+    /*
+     * A spline segment that is a polynomial of degree Degree (at most 5).
+     *
+     * Subclasses compute the coefficients of the polynomial in the power basis once when they are
+     * constructed. Evaluating the segment or any of its derivatives then only takes a few
+     * multiply-adds with Horner's method.
+     *
+     * The degree is a template parameter so that the evaluation is fully unrolled. Together with
+     * the subclasses being final, this lets code that knows the segment type (see PathEvaluator)
+     * inline the evaluation instead of going through a virtual call.
+     */
+    template <int Degree>
+    class PolynomialSegment : public SplineSegment {
+        static_assert(Degree >= 0 && Degree <= 5, "Degree must be between 0 and 5");
+
+    public:
+        static constexpr int DEGREE = Degree;
+
+        inline Vec2D at(double t) const override {
+            return eval<0>(t);
+        }
+        inline Vec2D deriv_at(double t) const override {
+            return eval<1>(t);
+        }
+        inline Vec2D second_deriv_at(double t) const override {
+            return eval<2>(t);
+        }
+        inline Vec2D third_deriv_at(double t) const override {
+            return eval<3>(t);
+        }
+
+        // Evaluates the position and the first two derivatives at t in one pass
+        inline void derivs_at(double t, Vec2D &pos, Vec2D &deriv, Vec2D &second_deriv) const {
+            Vec2D p = coeffs[Degree];
+            Vec2D d, dd;
+            for (int i = Degree - 1; i >= 0; i--) {
+                dd = dd * t + d;
+                d = d * t + p;
+                p = p * t + coeffs[i];
+            }
+            pos = p;
+            deriv = d;
+            second_deriv = dd * 2;
+        }
+
+        double max_curvature() const override;
+
+    protected:
+        // Evaluates the D-th derivative at t
+        template <int D>
+        inline Vec2D eval(double t) const {
+            double x = 0;
+            double y = 0;
+            for (int i = Degree; i >= D; i--) {
+                x = x * t + coeffs[i].x * detail::deriv_factors[D][i];
+                y = y * t + coeffs[i].y * detail::deriv_factors[D][i];
+            }
+            return Vec2D(x, y);
+        }
+
+        // coeffs[i] is the coefficient of t^i
+        Vec2D coeffs[Degree + 1];
+    };
+
+    // The instantiations used by the segments are in polynomialsegment.cpp
+    extern template class PolynomialSegment<3>;
+    extern template class PolynomialSegment<5>;
+} // namespace rpf
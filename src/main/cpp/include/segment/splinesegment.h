@@ -5,8 +5,14 @@
 namespace rpf {
     class SplineSegment {
     public:
+        virtual ~SplineSegment() = default;
+
         virtual Vec2D at(double) const = 0;
         virtual Vec2D deriv_at(double) const = 0;
         virtual Vec2D second_deriv_at(double) const = 0;
+        virtual Vec2D third_deriv_at(double) const = 0;
+
+        // Returns an upper bound on the absolute value of the curvature of this segment
+        virtual double max_curvature() const = 0;
     };
 } // namespace rpf
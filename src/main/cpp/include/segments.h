@@ -1,6 +1,8 @@
 #pragma once
 
 #include "segment/beziersegment.h"
+#include "segment/clothoidsegment.h"
 #include "segment/cubicsegment.h"
+#include "segment/polynomialsegment.h"
 #include "segment/quinticsegment.h"
 #include "segment/splinesegment.h"
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "trajectory/asyncgeneration.h"
 #include "trajectory/basicmoment.h"
 #include "trajectory/basictrajectory.h"
+#include "trajectory/incrementalgenerator.h"
+#include "trajectory/sampledpath.h"
+#include "trajectory/wheellimits.h"
 #include "trajectory/tankdrivemoment.h"
 #include "trajectory/tankdrivetrajectory.h"
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "robotspecs.h"
+#include "trajectory/basictrajectory.h"
+#include "trajectory/tankdrivetrajectory.h"
+#include "trajectoryparams.h"
+#include "util/cancellation.h"
+#include "util/threadpool.h"
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace rpf {
+    /*
+     * A trajectory being generated on a ThreadPool.
+     *
+     * This holds everything that does not depend on the type of the trajectory, so that jobs of
+     * both types can be kept track of together. The result is retrieved from AsyncTrajectory.
+     */
+    class GenerationJob {
+    public:
+        enum class Status : int { PENDING, RUNNING, DONE, FAILED, CANCELLED };
+
+        virtual ~GenerationJob() {
+        }
+
+        GenerationJob(const GenerationJob &) = delete;
+        GenerationJob &operator=(const GenerationJob &) = delete;
+
+        Status get_status() const;
+        // Whether the job is done, failed or was cancelled
+        bool is_finished() const;
+
+        // Cancels the job
+        // A job that is already running stops at the next check of its cancellation token, and
+        // drops anything it has generated so far
+        // Returns whether the job was cancelled, i.e. false if it had already finished
+        // If this returns true, the job always ends up CANCELLED, even if it was running
+        bool cancel();
+
+        void wait() const;
+        // Returns whether the job finished within the timeout (in seconds)
+        bool wait_for(double timeout) const;
+
+        // The message of the exception that made the job fail, or empty if it did not fail
+        std::string get_error() const;
+
+        // Adds a function to be called once the job is finished (including when it is cancelled)
+        // It is called on the thread that finishes the job, or right away on this thread if the
+        // job is already finished
+        void on_complete(std::function<void()> callback);
+
+    protected:
+        GenerationJob(const RobotSpecs &specs, const TrajectoryParams &params)
+                : specs(specs), params(params) {
+        }
+
+        // Generates the trajectory on the calling thread, unless the job was cancelled
+        void run();
+        // Publishes the result, then updates the status and calls the callbacks
+        // This is the only place that sets the final status, so wait() never returns too early
+        void finish(Status status, std::exception_ptr ex, const std::string &error);
+
+        // Generates and stores the trajectory
+        virtual void generate() = 0;
+        // Hands the trajectory, or the exception if ex is not null, to the future
+        virtual void publish(std::exception_ptr ex) = 0;
+
+        RobotSpecs specs;
+        TrajectoryParams params;
+        // Passed to the generation, and cancelled when a running job is cancelled
+        CancellationToken token;
+
+        mutable std::mutex mutex;
+        mutable std::condition_variable cv;
+        Status status = Status::PENDING;
+        // Set once it has been decided how the job ends, which cancel() can no longer change
+        // This is set by run(), or by cancel() if the job was still pending
+        bool finishing = false;
+        std::string error;
+        std::vector<std::function<void()>> callbacks;
+    };
+
+    /*
+     * Generates a trajectory of type T (BasicTrajectory or TankDriveTrajectory) in the background.
+     *
+     * The result can be waited for through the job itself, or through a std::shared_future.
+     */
+    template <typename T>
+    class AsyncTrajectory : public GenerationJob {
+    public:
+        // Starts generating the trajectory on the pool
+        static std::shared_ptr<AsyncTrajectory<T>> start(const RobotSpecs &specs,
+                const TrajectoryParams &params, ThreadPool &pool = ThreadPool::shared()) {
+            std::shared_ptr<AsyncTrajectory<T>> job(new AsyncTrajectory<T>(specs, params));
+            // The task keeps the job alive until it has run
+            // If the pool shuts down before that, the job is cancelled, so it still finishes
+            pool.submit([job]() { job->run(); }, [job]() { job->cancel(); });
+            return job;
+        }
+
+        // Waits for the job to finish and returns the trajectory
+        // Rethrows the exception if generation failed, or throws GenerationCancelled
+        inline std::shared_ptr<T> get() const {
+            return future.get();
+        }
+        inline std::shared_future<std::shared_ptr<T>> get_future() const {
+            return future;
+        }
+
+    protected:
+        AsyncTrajectory(const RobotSpecs &specs, const TrajectoryParams &params)
+                : GenerationJob(specs, params), future(promise.get_future().share()) {
+        }
+
+        void generate() override {
+            result = std::make_shared<T>(specs, params, token);
+        }
+        void publish(std::exception_ptr ex) override {
+            if (ex) {
+                // The job may have been cancelled after the trajectory was generated
+                result = nullptr;
+                promise.set_exception(ex);
+            }
+            else {
+                promise.set_value(result);
+            }
+        }
+
+        std::shared_ptr<T> result;
+        std::promise<std::shared_ptr<T>> promise;
+        std::shared_future<std::shared_ptr<T>> future;
+    };
+
+    /*
+     * Holds the latest of a series of generation jobs, e.g. for an editor that regenerates a
+     * trajectory every time it is changed.
+     *
+     * Submitting a new job cancels the previous one, since its result would be stale by the time
+     * it is done anyway. This way at most one job per slot takes up the pool.
+     */
+    template <typename T>
+    class GenerationSlot {
+    public:
+        explicit GenerationSlot(ThreadPool &pool = ThreadPool::shared()) : pool(pool) {
+        }
+        // Cancels the current job
+        ~GenerationSlot() {
+            cancel();
+        }
+
+        GenerationSlot(const GenerationSlot &) = delete;
+        GenerationSlot &operator=(const GenerationSlot &) = delete;
+
+        // Cancels the current job, and starts generating a new trajectory in its place
+        std::shared_ptr<AsyncTrajectory<T>> submit(
+                const RobotSpecs &specs, const TrajectoryParams &params) {
+            auto next = AsyncTrajectory<T>::start(specs, params, pool);
+            std::shared_ptr<AsyncTrajectory<T>> prev;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                prev = job;
+                job = next;
+            }
+            if (prev) {
+                prev->cancel();
+            }
+            return next;
+        }
+
+        // The job that was submitted last, or null if there is none
+        inline std::shared_ptr<AsyncTrajectory<T>> current() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return job;
+        }
+
+        void cancel() {
+            std::shared_ptr<AsyncTrajectory<T>> prev;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                prev = job;
+            }
+            if (prev) {
+                prev->cancel();
+            }
+        }
+
+    protected:
+        ThreadPool &pool;
+
+        mutable std::mutex mutex;
+        std::shared_ptr<AsyncTrajectory<T>> job;
+    };
+} // namespace rpf
@@ -4,7 +4,11 @@
 #include "paths.h"
 #include "robotspecs.h"
 #include "trajectory/basicmoment.h"
+#include "trajectory/incrementalgenerator.h"
+#include "trajectory/tankdrivemoment.h"
 #include "trajectoryparams.h"
+#include "util/cancellation.h"
+#include <algorithm>
 #include <limits>
 #include <list>
 #include <memory>
@@ -17,6 +21,13 @@ namespace rpf {
     class BasicTrajectory {
     public:
         BasicTrajectory(const RobotSpecs &specs, const TrajectoryParams &params);
+        // Throws GenerationCancelled if the token is cancelled before generation is done
+        BasicTrajectory(const RobotSpecs &specs, const TrajectoryParams &params,
+                const CancellationToken &token);
+        // Generates a trajectory along a path that is already sampled, with its params
+        // Throws std::invalid_argument if the params are tank and the base width of the specs is
+        // not the one the path was sampled with
+        BasicTrajectory(const RobotSpecs &specs, std::shared_ptr<const SampledPath> geometry);
 
         inline std::shared_ptr<Path> get_path() {
             return path;
@@ -24,14 +35,24 @@ namespace rpf {
         inline std::shared_ptr<const Path> get_path() const {
             return path;
         }
+        // The moments the trajectory is made of
+        // These are shared with the views of the trajectory (see time_scaled(), transformed() and
+        // subtrajectory()), which apply their transform on top of them, so moment() and
+        // moment_count() have to be used to get the moments of a view
         inline std::vector<BasicMoment> &get_moments() {
-            return moments;
+            return *moments;
         }
         inline const std::vector<BasicMoment> &get_moments() const {
-            return moments;
+            return *moments;
         }
+        inline std::size_t moment_count() const {
+            // Subtrajectories start and end with moments interpolated at the ends of the window
+            return is_window() ? window_last - window_first + 2 : moments->size();
+        }
+        // The moment at index i, as seen through the view
+        BasicMoment moment(std::size_t i) const;
         inline double get_init_facing() const {
-            return init_facing;
+            return transform.apply_angle(init_facing);
         }
 
         inline RobotSpecs &get_specs() {
@@ -48,7 +69,11 @@ namespace rpf {
         }
 
         inline double total_time() const {
-            return moments[moments.size() - 1].time;
+            return (std::min(window_end, moments->back().time) - window_begin) * time_scale;
+        }
+        // How many times slower this is than the moments it is made of
+        inline double get_time_scale() const {
+            return time_scale;
         }
         inline bool is_tank() const {
             return params.is_tank;
@@ -60,14 +85,54 @@ namespace rpf {
         std::shared_ptr<BasicTrajectory> mirror_lr() const;
         std::shared_ptr<BasicTrajectory> mirror_fb() const;
         std::shared_ptr<BasicTrajectory> retrace() const;
+        /*
+         * Gets a view of this trajectory that is slower by factor, e.g. 1 / 0.7 to run it at 70%
+         * speed. Times are multiplied by factor, velocities are divided by it, and accelerations
+         * are divided by its square, while positions and headings stay the same.
+         *
+         * Nothing is regenerated or copied: the view shares the moments and the path with this
+         * trajectory, and applies the scaling whenever it is queried. The view is not checked
+         * against the specs, so it can go over their limits if factor is below 1.
+         * Throws std::invalid_argument if factor is not positive and finite.
+         */
+        std::shared_ptr<BasicTrajectory> time_scaled(double factor) const;
+        /*
+         * Gets a view of this trajectory that is moved by transform, e.g. to make a trajectory that
+         * was generated ahead of time start where the robot really is.
+         *
+         * Like time_scaled(), nothing is regenerated or copied: the view shares the moments with
+         * this trajectory, and its path shares the segments and lookup table with this one's. Only
+         * the positions and headings it returns are transformed.
+         */
+        std::shared_ptr<BasicTrajectory> transformed(const RigidTransform &transform) const;
+        // Same as transformed(), with the transform that moves get_pos(0) to pose
+        std::shared_ptr<BasicTrajectory> anchored_at(const Waypoint &pose) const;
+        /*
+         * Gets a view of the part of this trajectory between the times t0 and t1, e.g. to only
+         * follow it up to where a game piece is picked up. Times and positions are relative to t0,
+         * so the view starts at time 0 and position 0 like any other trajectory.
+         *
+         * Like time_scaled(), nothing is regenerated or copied. The view starts and ends with the
+         * moments at t0 and t1, and has the moments of this trajectory that are between them.
+         * Throws std::invalid_argument if the times are not increasing and within this trajectory.
+         */
+        std::shared_ptr<BasicTrajectory> subtrajectory(double t0, double t1) const;
 
         friend class TankDriveTrajectory;
+        friend class IncrementalGenerator;
 
     protected:
+        // The token is checked periodically during generation if it is not null
+        BasicTrajectory(const RobotSpecs &specs, const TrajectoryParams &params,
+                const CancellationToken *token);
+        // Takes the trajectory from a generator that is done
+        explicit BasicTrajectory(IncrementalGenerator &gen);
         BasicTrajectory(std::shared_ptr<Path> path, std::vector<BasicMoment> &&moments,
                 bool backwards, const RobotSpecs &specs, const TrajectoryParams &params)
-                : path(path), moments(moments), backwards(backwards), specs(specs), params(params),
-                  init_facing(moments[0].init_facing) {
+                : path(path),
+                  moments(std::make_shared<std::vector<BasicMoment>>(std::move(moments))),
+                  backwards(backwards), specs(specs), params(params),
+                  init_facing((*this->moments)[0].init_facing) {
         }
 
         /**
@@ -75,9 +140,40 @@ namespace rpf {
          * Returns the indexes of the two moments with a time closest to the argument.
          */
         std::pair<std::size_t, std::size_t> search_moments(double t) const;
+        // Gets the moment at t from the result of search_moments()
+        // t is the time of the moments, which is not scaled
+        BasicMoment interpolate(std::pair<std::size_t, std::size_t> m, double t) const;
+        // Applies the time scale and transform to a moment of the moments, which is at t in this
+        // trajectory
+        BasicMoment view(BasicMoment moment, double t) const;
+        // Converts a time in this trajectory to a time of the moments
+        inline double source_time(double t) const {
+            if (!is_window()) {
+                return t / time_scale;
+            }
+            return std::min(std::max(t / time_scale + window_begin, window_begin), window_end);
+        }
+        inline bool is_window() const {
+            return window_end != std::numeric_limits<double>::infinity();
+        }
+        // Makes this a subtrajectory of the moments between the times begin and end
+        void set_window(double begin, double end);
 
         std::shared_ptr<Path> path = nullptr;
-        std::vector<BasicMoment> moments;
+        // The times of the moments are not scaled
+        std::shared_ptr<std::vector<BasicMoment>> moments =
+                std::make_shared<std::vector<BasicMoment>>();
+        double time_scale = 1;
+        // The path is transformed too, so this is only needed for the headings
+        RigidTransform transform;
+        // The times of the moments that subtrajectories start and end at
+        // The end is infinite if the trajectory is not a subtrajectory
+        double window_begin = 0;
+        double window_end = std::numeric_limits<double>::infinity();
+        // The first moment after the start of the window, and the first one at or after its end
+        std::size_t window_first = 0, window_last = 0;
+        // The position of the moments at the start of the window, which is subtracted from them
+        double pos_offset = 0;
 
         bool backwards = false;
 
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "paths.h"
+#include "robotspecs.h"
+#include "trajectory/basicmoment.h"
+#include "trajectory/sampledpath.h"
+#include "trajectory/tankdrivemoment.h"
+#include "trajectory/wheellimits.h"
+#include "trajectoryparams.h"
+#include "util/cancellation.h"
+#include "util/instrumentation.h"
+#include <exception>
+#include <list>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace rpf {
+    class BasicTrajectory;
+    class TankDriveTrajectory;
+
+    /*
+     * Generates a trajectory in small steps that can be spread out over time.
+     *
+     * Generation is split into phases (measuring the path, sampling it, finding the velocity
+     * limits, the forwards and backwards passes, and filling in the times), which each go over all
+     * the samples. The generator keeps track of where it is, so that it can stop after any number
+     * of samples and pick up from there later. This lets a robot generate a trajectory on its main
+     * thread, by calling step() with a time budget every iteration of its loop.
+     *
+     * The BasicTrajectory and TankDriveTrajectory constructors also use this to generate their
+     * trajectories, by running every phase to the end in one go.
+     *
+     * The geometry of the path is sampled into a SampledPath by the first two phases. If one is
+     * given instead, those phases are skipped, and only the timing is generated.
+     *
+     * Normally no moment is known until the backwards pass has gone over it, which is only after
+     * the whole path has been processed. In streaming mode, the phases after the path length is
+     * measured are instead run together over a few samples at a time, and moments are settled as
+     * soon as the backwards pass can no longer change them. This is the case once the robot could
+     * come to a full stop between the moment and the furthest sample reached so far, since the
+     * samples that have not been reached can only ever slow the robot down to zero. The settled
+     * moments are the same as the ones of a trajectory generated in one go, and are added to the
+     * trajectory returned by get_basic() or get_tank() as they are settled, so that a robot can
+     * start following it long before generation is done.
+     */
+    class IncrementalGenerator {
+    public:
+        // If tank is true, a TankDriveTrajectory is generated; otherwise a BasicTrajectory is
+        // Throws std::invalid_argument if tank is true but the params are not tank
+        IncrementalGenerator(const RobotSpecs &specs, const TrajectoryParams &params, bool tank,
+                bool streaming = false);
+        // Generates a trajectory along a path that is already sampled, with its params
+        // Throws std::invalid_argument if the params are tank and the base width of the specs is
+        // not the one the path was sampled with
+        IncrementalGenerator(const RobotSpecs &specs, std::shared_ptr<const SampledPath> geometry,
+                bool tank, bool streaming = false);
+
+        IncrementalGenerator(const IncrementalGenerator &) = delete;
+        IncrementalGenerator &operator=(const IncrementalGenerator &) = delete;
+
+        /*
+         * Generates until the time budget (in microseconds) is used up or generation is done.
+         * At least a few samples are always processed, so that every call makes progress, and the
+         * budget is checked every few hundred samples, so it can be overrun by a small amount.
+         *
+         * Returns whether generation is done. Once it is, this does nothing and returns true, so it
+         * can keep being called every iteration of a loop.
+         * Throws the exception from the generation if it failed, and again for every call after.
+         * Throws std::runtime_error if the trajectory was taken by get_basic() or get_tank().
+         */
+        bool step(double budget_us);
+        // Generates everything that is left
+        // If the token is not null, it is checked every 1024 samples
+        // Throws like step()
+        void run(const CancellationToken *token = nullptr);
+
+        inline bool is_done() const {
+            return phase == Phase::DONE;
+        }
+        // Whether a TankDriveTrajectory is being generated
+        inline bool is_tank() const {
+            return tank;
+        }
+        inline bool is_streaming() const {
+            return streaming;
+        }
+        // The number of moments that are settled, and the time of the last one
+        // These are only ever non-zero before generation is done in streaming mode, and cover the
+        // whole trajectory after
+        inline std::size_t available() const {
+            return available_count;
+        }
+        inline double available_time() const {
+            return settled_time;
+        }
+        // The fraction of the work that is done, from 0 to 1
+        // This counts the samples processed by each phase, so it is only a rough estimate of time
+        double progress() const;
+
+        /*
+         * Gets the generated trajectory.
+         * These can only be called once generation is done, and only once per generator.
+         *
+         * In streaming mode, they can be called as soon as a moment is available, and always return
+         * the same trajectory, which only goes up to available_time() until generation is done.
+         * Settled moments are added to it by step(), so it must not be used on another thread while
+         * generating. A follower that catches up with the generator would see the trajectory end,
+         * so the generator has to be kept ahead of it.
+         */
+        std::shared_ptr<BasicTrajectory> get_basic();
+        std::shared_ptr<TankDriveTrajectory> get_tank();
+
+        friend class BasicTrajectory;
+        friend class TankDriveTrajectory;
+
+    protected:
+        enum class Phase : int {
+            // Only used when the path is not already sampled
+            LENGTH,
+            SAMPLE,
+            LIMITS,
+            FORWARD,
+            BACKWARD,
+            TIMES,
+            // All of the above after LENGTH, in streaming mode
+            STREAM,
+            DONE,
+            FAILED,
+            // The trajectory was handed out
+            TAKEN,
+        };
+
+        // Runs the current phase for up to chunk samples, and moves on to the next one if it is
+        // done
+        void advance(int chunk);
+        // The number of samples the phase goes over
+        int phase_length(Phase phase) const;
+        // Does what has to be done between the current phase and the next one
+        void next_phase();
+        // Throws if generation failed or the trajectory was taken, once generation is over
+        void check_finished() const;
+        // Records the exception being handled, and frees everything
+        void fail();
+        // Throws if the trajectory cannot be handed out
+        void check_done(bool tank) const;
+        // Everything the constructors have in common, once the geometry is set
+        void init();
+
+        // What has to be done before the phase with the same name
+        void prepare_sample();
+        void prepare_limits();
+        void prepare_forward();
+        void prepare_backward();
+        void prepare_times();
+
+        // The phases, each of which goes over [begin, end) of its samples
+        // This does nothing if the path is already sampled
+        void sample(int begin, int end);
+        void limit(int begin, int end);
+        // The two-pass generator
+        void forward(int begin, int end);
+        // Step i is for sample n - 2 - i
+        void backward(int begin, int end);
+        void fill_times(int begin, int end);
+        // Runs every phase after LENGTH over [begin, end) of the samples, and settles what it can
+        void stream(int begin, int end);
+        // The first sample after the settled ones whose velocity can no longer be changed by the
+        // backwards pass of the two-pass generator
+        int find_settled() const;
+        // Runs the backwards pass and everything after it over [begin, end) of the samples
+        // end has to be a sample whose velocity is final, or n
+        void settle(int begin, int end);
+
+        // Moves the result into a trajectory
+        void take(BasicTrajectory &traj);
+        void take(TankDriveTrajectory &traj);
+
+        RobotSpecs specs;
+        TrajectoryParams params;
+        bool tank;
+        bool streaming;
+        int n;
+
+        Phase phase = Phase::LENGTH;
+        // How far into the current phase generation is
+        int index = 0;
+        // How many samples all the phases before the current one went over
+        long long finished = 0;
+        long long total_work;
+        std::exception_ptr error;
+
+        // How far streaming mode has gotten: the number of samples with their limits, the last
+        // sample reached by the forwards pass, and the number of settled moments
+        int limited = 0, frontier = 0, settled = 0;
+        // The frontier at which to look for settled samples again
+        int next_probe = 0;
+        // The number of moments in the trajectory, and the time of the last one
+        // For tank drive trajectories, this is one behind the settled samples until the end
+        std::size_t available_count = 0;
+        double settled_time = 0;
+        // The trajectory that the settled moments are added to
+        std::shared_ptr<BasicTrajectory> stream_basic;
+        std::shared_ptr<TankDriveTrajectory> stream_tank;
+
+        std::shared_ptr<const SampledPath> geometry;
+        // The same as geometry if it is sampled by this generator, or null if it was given
+        SampledPath *sampling = nullptr;
+        // The distance between two samples
+        double dpi = 0;
+        // Additional velocity constraints from the waypoints, as (distance, velocity) pairs
+        // This is a copy of the ones in geometry, since the two-pass generator uses them up
+        std::list<std::pair<double, double>> constraints;
+
+        // The max velocity and dk/ds (for the interval after) of each sample
+        std::vector<double> mv, dk;
+        // The time differences between moments, or NaN where the acceleration is zero
+        std::vector<double> time_diff;
+
+        WheelLimits limits;
+        // The samples which have a velocity constraint in the two-pass generator
+        std::unordered_set<int> constrained;
+
+        std::vector<BasicMoment> moments;
+        // In streaming mode, this only has the tank drive moments that are not in the trajectory
+        std::vector<TankDriveMoment> tank_moments;
+        double init_facing = 0;
+        // The radius of each sample, for basic trajectories with tank params
+        std::shared_ptr<std::vector<double>> pathr;
+
+        // The time spent in forward() and backward(), over all the steps
+        ProbeTotal forward_time{Probe::FORWARD_PASS}, backward_time{Probe::BACKWARD_PASS};
+    };
+} // namespace rpf
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "paths.h"
+#include "trajectoryparams.h"
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace rpf {
+    class IncrementalGenerator;
+
+    /*
+     * The geometry of a trajectory, sampled at evenly spaced distances along its path.
+     *
+     * Everything here depends only on the path, and not on how fast the robot can go, so one
+     * SampledPath can be used to generate trajectories for any number of RobotSpecs (e.g. several
+     * speed presets) without measuring and sampling the path again for each of them. Only the
+     * timing passes are run for each trajectory.
+     *
+     * For tank drive params, the curvature is only kept where it can make a difference to the
+     * wheels, which depends on the base width, so trajectories can only be generated from it for
+     * specs with the same base width.
+     *
+     * The path and the path t of each sample are shared with every trajectory generated from this.
+     */
+    class SampledPath {
+    public:
+        // Measures and samples the whole path
+        // The base width is ignored if the params are not tank
+        SampledPath(const TrajectoryParams &params, double base_width);
+
+        SampledPath(const SampledPath &) = delete;
+        SampledPath &operator=(const SampledPath &) = delete;
+
+        inline const TrajectoryParams &get_params() const {
+            return params;
+        }
+        inline double get_base_width() const {
+            return base_width;
+        }
+        inline int size() const {
+            return n;
+        }
+        inline std::shared_ptr<const Path> get_path() const {
+            return path;
+        }
+        // The length of the path, and the distance between two samples
+        inline double get_length() const {
+            return path->get_len();
+        }
+        inline double get_spacing() const {
+            return dpi;
+        }
+        // The path t, heading and curvature at each sample
+        // The curvature is 0 everywhere for params that are not tank
+        inline const std::vector<double> &get_t() const {
+            return *patht;
+        }
+        inline const std::vector<double> &get_headings() const {
+            return headings;
+        }
+        inline const std::vector<double> &get_curvatures() const {
+            return k;
+        }
+        // The velocity constraints of the waypoints, as (distance, velocity) pairs sorted by
+        // distance
+        inline const std::list<std::pair<double, double>> &get_constraints() const {
+            return constraints;
+        }
+
+        friend class IncrementalGenerator;
+
+    protected:
+        // Makes the path without measuring or sampling it, for IncrementalGenerator to do in steps
+        SampledPath(const TrajectoryParams &params, double base_width, bool sample);
+
+        // Computes the length lookup table for [begin, end) of the samples
+        void measure(int begin, int end);
+        // Finds the sample spacing and the constraints once the path is measured
+        void prepare();
+        // Samples [begin, end) of the path
+        void sample(int begin, int end);
+
+        TrajectoryParams params;
+        double base_width;
+        int n;
+
+        std::shared_ptr<Path> path;
+        // The distance between two samples, as a fraction of the whole path and as a distance
+        double ds, dpi = 0;
+        std::list<std::pair<double, double>> constraints;
+        // Where s2t() left off in sample()
+        std::size_t s2t_cursor = 0;
+
+        std::shared_ptr<std::vector<double>> patht = std::make_shared<std::vector<double>>();
+        std::vector<double> headings, k;
+    };
+} // namespace rpf
@@ -3,10 +3,14 @@
 #include "basictrajectory.h"
 #include "math/rpfmath.h"
 #include "math/vec2d.h"
+#include "motionprofile/tankdriverotationprofile.h"
 #include "paths.h"
 #include "robotspecs.h"
 #include "trajectory/tankdrivemoment.h"
 #include "trajectoryparams.h"
+#include "util/cancellation.h"
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -16,6 +20,19 @@ namespace rpf {
     class TankDriveTrajectory {
     public:
         TankDriveTrajectory(const BasicTrajectory &traj);
+        // Generates the trajectory directly, without keeping a BasicTrajectory around or going
+        // over its moments again
+        TankDriveTrajectory(const RobotSpecs &specs, const TrajectoryParams &params);
+        // Throws GenerationCancelled if the token is cancelled before generation is done
+        TankDriveTrajectory(const RobotSpecs &specs, const TrajectoryParams &params,
+                const CancellationToken &token);
+        // Generates a trajectory along a path that is already sampled, with its params
+        // Throws std::invalid_argument if the params are not tank, or if the base width of the
+        // specs is not the one the path was sampled with
+        TankDriveTrajectory(const RobotSpecs &specs, std::shared_ptr<const SampledPath> geometry);
+        // A turn in place, which is computed from the profile directly instead of moments
+        // The trajectory has no path, and its moments only hold the start and the end of the turn
+        TankDriveTrajectory(const TankDriveRotationProfile &rotation);
 
         inline std::shared_ptr<Path> get_path() {
             return path;
@@ -23,14 +40,24 @@ namespace rpf {
         inline std::shared_ptr<const Path> get_path() const {
             return path;
         }
+        // The moments the trajectory is made of
+        // These are shared with the views of the trajectory (see time_scaled(), transformed() and
+        // subtrajectory()), which apply their transform on top of them, so moment() and
+        // moment_count() have to be used to get the moments of a view
         inline std::vector<TankDriveMoment> &get_moments() {
-            return moments;
+            return *moments;
         }
         inline const std::vector<TankDriveMoment> &get_moments() const {
-            return moments;
+            return *moments;
         }
+        inline std::size_t moment_count() const {
+            // Subtrajectories start and end with moments interpolated at the ends of the window
+            return is_window() ? window_last - window_first + 2 : moments->size();
+        }
+        // The moment at index i, as seen through the view
+        TankDriveMoment moment(std::size_t i) const;
         inline double get_init_facing() const {
-            return init_facing;
+            return transform.apply_angle(init_facing);
         }
 
         inline RobotSpecs &get_specs() {
@@ -47,21 +74,49 @@ namespace rpf {
         }
 
         inline double total_time() const {
-            return moments[moments.size() - 1].time;
+            return (std::min(window_end, moments->back().time) - window_begin) * time_scale;
+        }
+        // How many times slower this is than the moments it is made of
+        inline double get_time_scale() const {
+            return time_scale;
         }
 
         TankDriveMoment get(double t) const;
+        // Same as get(double), but starts searching from the moment at cursor and updates it
+        // This is much faster when the times passed in are increasing, e.g. when following
+        TankDriveMoment get(double t, std::size_t &cursor) const;
         Waypoint get_pos(double t) const;
 
         std::shared_ptr<TankDriveTrajectory> mirror_lr() const;
         std::shared_ptr<TankDriveTrajectory> mirror_fb() const;
         std::shared_ptr<TankDriveTrajectory> retrace() const;
+        // Gets a view of this trajectory that is slower by factor, without regenerating or copying
+        // it, the same way as BasicTrajectory::time_scaled()
+        // Throws std::invalid_argument if factor is not positive and finite
+        std::shared_ptr<TankDriveTrajectory> time_scaled(double factor) const;
+        // Gets a view of this trajectory that is moved by transform, without regenerating or
+        // copying it, the same way as BasicTrajectory::transformed()
+        std::shared_ptr<TankDriveTrajectory> transformed(const RigidTransform &transform) const;
+        // Same as transformed(), with the transform that moves get_pos(0) to pose
+        std::shared_ptr<TankDriveTrajectory> anchored_at(const Waypoint &pose) const;
+        // Gets a view of the part of this trajectory between the times t0 and t1, without
+        // regenerating or copying it, the same way as BasicTrajectory::subtrajectory()
+        // Throws std::invalid_argument if the times are not increasing and within this trajectory
+        std::shared_ptr<TankDriveTrajectory> subtrajectory(double t0, double t1) const;
+
+        friend class IncrementalGenerator;
 
     protected:
+        TankDriveTrajectory(const RobotSpecs &specs, const TrajectoryParams &params,
+                const CancellationToken *token);
+        // Takes the trajectory from a generator that is done
+        explicit TankDriveTrajectory(IncrementalGenerator &gen);
         TankDriveTrajectory(std::shared_ptr<Path> path, std::vector<TankDriveMoment> &&moments,
                 bool backwards, const RobotSpecs &specs, const TrajectoryParams &params)
-                : path(path), moments(moments), backwards(backwards), specs(specs), params(params),
-                  init_facing(moments[0].init_facing) {
+                : path(path),
+                  moments(std::make_shared<std::vector<TankDriveMoment>>(std::move(moments))),
+                  backwards(backwards), specs(specs), params(params),
+                  init_facing((*this->moments)[0].init_facing) {
         }
 
         /**
@@ -69,12 +124,58 @@ namespace rpf {
          * Returns the indexes of the two moments with a time closest to the argument.
          */
         std::pair<std::size_t, std::size_t> search_moments(double t) const;
+        // Searches forwards from cursor, and only falls back to a binary search if t is before it
+        std::pair<std::size_t, std::size_t> search_moments(double t, std::size_t &cursor) const;
+        // Gets the moment at t from the result of search_moments()
+        // t is the time of the moments, which is not scaled
+        TankDriveMoment interpolate(std::pair<std::size_t, std::size_t> m, double t) const;
+        // Gets the moment at the time of the moments t, including for turns in place
+        TankDriveMoment source_get(double t) const;
+        // Applies the time scale and transform to a moment of the moments, which is at t in this
+        // trajectory
+        TankDriveMoment view(TankDriveMoment moment, double t) const;
+        // Converts a time in this trajectory to a time of the moments
+        inline double source_time(double t) const {
+            if (!is_window()) {
+                return t / time_scale;
+            }
+            return std::min(std::max(t / time_scale + window_begin, window_begin), window_end);
+        }
+        inline bool is_window() const {
+            return window_end != std::numeric_limits<double>::infinity();
+        }
+        // Makes this a subtrajectory of the moments between the times begin and end
+        void set_window(double begin, double end);
+        // Sets the facing of a turn in place, which is not the one of its profile once it is
+        // mirrored front to back
+        void set_rotation_facing(double init_facing, bool backwards);
+
+        // Appends the moment for the center moment cur, which comes right after prev
+        // prev is null for the first moment
+        static void push_moment(std::vector<TankDriveMoment> &moments, const BasicMoment *prev,
+                const BasicMoment &cur, double k, double base_radius, double init_facing);
 
         std::shared_ptr<Path> path;
-        std::vector<TankDriveMoment> moments;
+        // The times of the moments are not scaled
+        std::shared_ptr<std::vector<TankDriveMoment>> moments =
+                std::make_shared<std::vector<TankDriveMoment>>();
+        double time_scale = 1;
+        // The path is transformed too, so this is only needed for the headings
+        RigidTransform transform;
+        // The times of the moments that subtrajectories start and end at
+        // The end is infinite if the trajectory is not a subtrajectory
+        double window_begin = 0;
+        double window_end = std::numeric_limits<double>::infinity();
+        // The first moment after the start of the window, and the first one at or after its end
+        std::size_t window_first = 0, window_last = 0;
+        // The positions of the wheels at the start of the window, which are subtracted from them
+        double l_pos_offset = 0, r_pos_offset = 0;
 
         std::shared_ptr<std::vector<double>> patht;
 
+        // Only set for turns in place
+        std::shared_ptr<const TankDriveRotationProfile> rotation;
+
         bool backwards = false;
 
         RobotSpecs specs;
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "robotspecs.h"
+
+namespace rpf {
+
+    /**
+     * The velocity and acceleration limits of the wheels of a robot, as seen by the trajectory
+     * generators.
+     *
+     * Velocities are expressed as x = v^2 of the center of the robot, as a function of the path
+     * distance s. The acceleration of the center is then a = (dx/ds) / 2.
+     *
+     * For tank drive robots, the wheel velocities are v(1 - bk) and v(1 + bk), where b is the base
+     * radius and k is the curvature of the path. Differentiating with respect to time gives the
+     * wheel accelerations a(1 - bk) - x b dk/ds and a(1 + bk) + x b dk/ds. The max velocity and
+     * acceleration in the specs are applied to both of these. For basic trajectories the base
+     * radius is 0, which makes the limits apply to the center of the robot.
+     *
+     * If the specs have a voltage limit, the voltage kV * v + kA * a of each wheel is also kept
+     * under the max voltage.
+     */
+    class WheelLimits {
+    public:
+        WheelLimits(const RobotSpecs &specs, double base_radius);
+
+        /*
+         * Returns the highest x at a sample with curvature k, next to an interval with
+         * dk/ds = dk.
+         *
+         * Besides the max velocity, this makes sure that the robot is able to keep its velocity
+         * constant through the interval. Above this, the wheel accelerations caused by the change
+         * in curvature alone are too high, and the passes would be forced to speed up or slow
+         * down the robot.
+         */
+        double max_vel_sq(double k, double dk) const;
+
+        /*
+         * Between two samples, the wheel accelerations computed from the moments are
+         * (c1 v1 - c0 v0) / dt = c0 (x1 - x0) / 2ds + dc v1 (v0 + v1) / 2
+         * so the x in the dc term is really v1 (v0 + v1) / 2 instead of x0 or x1. The two methods
+         * below take a step with the bounds at the known end, then refine the step once using the
+         * bounds at the effective x, so that the limits also hold for the generated moments.
+         * The step is capped before refining so that the effective x stays under the maximum
+         * velocity curve.
+         */
+        // Finds the highest x1 (up to cap) reachable from x0
+        double step_forward(double k0, double dk, double x0, double cap, double ds) const;
+        // Finds the highest x0 (up to cap) from which x1 can still be reached
+        double step_backward(double k0, double dk, double x1, double cap, double ds) const;
+        // Finds a lower bound of step_backward() for every x1 from x1_lo to x1_hi
+        // step_backward() itself does not always go up with x1, because the wheel accelerations
+        // caused by the change in curvature go up with the velocity
+        double step_backward_bound(
+                double k0, double dk, double x1_lo, double x1_hi, double cap, double ds) const;
+
+    protected:
+        // Finds the range of center accelerations that keep both wheels in range
+        // v is the velocity used for the voltage limit and x is the one used for the dk/ds term
+        void accel_bounds(double k, double dk, double v, double x, double &lo, double &hi) const;
+
+        double b;
+        double max_v, max_a;
+        // The voltage limit is only used if max_voltage is not NaN
+        bool voltage;
+        double max_voltage, kv, ka;
+    };
+} // namespace rpf
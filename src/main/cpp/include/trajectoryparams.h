@@ -6,11 +6,21 @@
 #include <vector>
 
 namespace rpf {
+    enum GeneratorType : int {
+        // Forward-backward passes with the per-wheel limits (Team 254 style)
+        TWO_PASS = 1,
+        // The same as TWO_PASS, whose passes already integrate with the most acceleration and
+        // deceleration the per-wheel limits allow
+        TIME_OPTIMAL = 2,
+    };
+
+    // The defaults are the same as the ones of the Java TrajectoryParams
     struct TrajectoryParams {
         std::vector<Waypoint> waypoints;
         double alpha = std::numeric_limits<double>::quiet_NaN();
-        int sample_count;
-        bool is_tank;
-        PathType type;
+        int sample_count = 1000;
+        bool is_tank = false;
+        PathType type = PathType::QUINTIC_HERMITE;
+        GeneratorType generator = GeneratorType::TWO_PASS;
     };
 } // namespace rpf
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+namespace rpf {
+    // Thrown when trajectory generation is cancelled, or when getting the result of a job that was
+    // cancelled
+    class GenerationCancelled : public std::runtime_error {
+    public:
+        GenerationCancelled() : std::runtime_error("Trajectory generation was cancelled") {
+        }
+    };
+
+    /*
+     * A flag that asks long-running work such as trajectory generation to stop early.
+     *
+     * Copies share the same flag, so one copy can be handed to the work while another is kept to
+     * cancel it from a different thread. The work checks the flag every now and then, and throws
+     * GenerationCancelled when it is set, which frees everything it has allocated so far.
+     */
+    class CancellationToken {
+    public:
+        CancellationToken() : flag(std::make_shared<std::atomic<bool>>(false)) {
+        }
+
+        inline void cancel() const {
+            flag->store(true, std::memory_order_relaxed);
+        }
+        inline bool is_cancelled() const {
+            return flag->load(std::memory_order_relaxed);
+        }
+        inline void throw_if_cancelled() const {
+            if (is_cancelled()) {
+                throw GenerationCancelled();
+            }
+        }
+
+    protected:
+        std::shared_ptr<std::atomic<bool>> flag;
+    };
+
+    // Checks the token, if there is one
+    inline void check_cancelled(const CancellationToken *token) {
+        if (token) {
+            token->throw_if_cancelled();
+        }
+    }
+} // namespace rpf
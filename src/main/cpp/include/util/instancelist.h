@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace rpf {
+    /*
+     * Helpers for the lists of live native objects owned by the Java side (see jni/instlists.h).
+     * These do not depend on JNI, so that they can also be used by native-only code.
+     */
+    template <typename T>
+    bool remove_instance(
+            std::list<std::shared_ptr<T>> &instances, std::mutex &instances_mutex, T *ptr) {
+        // Acquire lock to the mutex
+        std::lock_guard<std::mutex> lock(instances_mutex);
+        auto it = std::find_if(
+                instances.begin(), instances.end(), [&](const auto &p) { return p.get() == ptr; });
+        if (it != instances.end()) {
+            instances.erase(it);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+    template <typename T>
+    bool check_instance(
+            std::list<std::shared_ptr<T>> &instances, std::mutex &instances_mutex, T *ptr) {
+        // Acquire lock to the mutex
+        std::lock_guard<std::mutex> lock(instances_mutex);
+        auto it = std::find_if(
+                instances.begin(), instances.end(), [&](const auto &p) { return p.get() == ptr; });
+        return it != instances.end();
+    }
+    // Returns the shared_ptr that owns ptr, or null if there is none
+    template <typename T>
+    std::shared_ptr<T> find_instance(
+            std::list<std::shared_ptr<T>> &instances, std::mutex &instances_mutex, T *ptr) {
+        // Acquire lock to the mutex
+        std::lock_guard<std::mutex> lock(instances_mutex);
+        auto it = std::find_if(
+                instances.begin(), instances.end(), [&](const auto &p) { return p.get() == ptr; });
+        return it != instances.end() ? *it : nullptr;
+    }
+} // namespace rpf
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/*
+ * Optional timing probes for the slow parts of the library.
+ *
+ * The probes are only compiled in if RPF_INSTRUMENTATION is defined (e.g. by building with
+ * -Pinstrumentation). Otherwise the macros below expand to nothing, and the snapshot is always
+ * empty.
+ *
+ * RPF_PROBE_SCOPE(probe) times the rest of the enclosing scope. RPF_PROBE_BEGIN(name, probe)
+ * and RPF_PROBE_END(name) time a section of code without adding a scope around it.
+ *
+ * Work that is split up into pieces which run at different times is timed with a ProbeTotal:
+ * RPF_PROBE_ADD(total) adds the time of the rest of the enclosing scope to it, and
+ * RPF_PROBE_RECORD(total) records everything added so far as one time.
+ */
+#ifdef RPF_INSTRUMENTATION
+#define RPF_PROBE_CONCAT2(a, b) a##b
+#define RPF_PROBE_CONCAT(a, b) RPF_PROBE_CONCAT2(a, b)
+#define RPF_PROBE_SCOPE(probe) \
+    rpf::ScopedProbe RPF_PROBE_CONCAT(rpf_probe_, __LINE__)(rpf::Probe::probe)
+#define RPF_PROBE_BEGIN(name, probe) rpf::ScopedProbe name(rpf::Probe::probe)
+#define RPF_PROBE_END(name) name.stop()
+#define RPF_PROBE_ADD(total) \
+    rpf::ProbeTotal::Section RPF_PROBE_CONCAT(rpf_probe_, __LINE__)(total)
+#define RPF_PROBE_RECORD(total) (total).record()
+#else
+#define RPF_PROBE_SCOPE(probe) static_cast<void>(0)
+#define RPF_PROBE_BEGIN(name, probe) static_cast<void>(0)
+#define RPF_PROBE_END(name) static_cast<void>(0)
+#define RPF_PROBE_ADD(total) static_cast<void>(0)
+#define RPF_PROBE_RECORD(total) static_cast<void>(0)
+#endif
+
+namespace rpf {
+
+    enum class Probe : int {
+        PATH_CONSTRUCT,
+        PATH_COMPUTE_LEN,
+        // The loop in BasicTrajectory that samples the path
+        SAMPLE,
+        // The whole pass over a trajectory, even if it is generated a bit at a time
+        FORWARD_PASS,
+        BACKWARD_PASS,
+        // Building a TankDriveTrajectory from a BasicTrajectory
+        TANK_INTEGRATE,
+        // Converting between Java and C++ objects
+        JNI_MARSHAL,
+        // Looking up a moment of a trajectory
+        QUERY,
+        COUNT
+    };
+    const char *probe_name(Probe probe);
+
+    // All times are in seconds
+    struct ProbeSnapshot {
+        Probe probe;
+        std::uint64_t count = 0;
+        double total = 0, min = 0, max = 0;
+        // Estimated from a histogram, with a relative error of up to 1/16
+        double p50 = 0, p99 = 0;
+    };
+
+    constexpr bool probes_enabled() {
+#ifdef RPF_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /*
+     * Records a time for a probe.
+     *
+     * Each thread records into its own counters and histograms, so this never waits on a lock
+     * (except the first time it is called on each thread) or contends with other threads.
+     */
+    void record_probe(Probe probe, std::int64_t ns);
+    // Returns the stats of every probe that was recorded at least once, summed across threads
+    std::vector<ProbeSnapshot> probe_snapshot();
+    // Clears all the stats
+    // Times recorded by other threads while this is running may be partially lost
+    void reset_probes();
+
+    class ScopedProbe {
+    public:
+        explicit ScopedProbe(Probe probe);
+        ~ScopedProbe() {
+            stop();
+        }
+
+        ScopedProbe(const ScopedProbe &) = delete;
+        ScopedProbe &operator=(const ScopedProbe &) = delete;
+
+        // Records the time so far; does nothing if already stopped
+        void stop();
+
+    protected:
+        Probe probe;
+        std::int64_t start;
+        bool stopped = false;
+    };
+
+    // Adds up the times of several sections of code, to be recorded as one time of a probe
+    class ProbeTotal {
+    public:
+        explicit ProbeTotal(Probe probe) : probe(probe) {
+        }
+
+        // Records the total so far and starts over; does nothing if nothing was added
+        void record();
+
+        // Adds the time from its construction to its destruction to a total
+        class Section {
+        public:
+            explicit Section(ProbeTotal &total);
+            ~Section();
+
+            Section(const Section &) = delete;
+            Section &operator=(const Section &) = delete;
+
+        protected:
+            ProbeTotal &total;
+            std::int64_t start;
+        };
+
+    protected:
+        Probe probe;
+        std::int64_t total = 0;
+        bool added = false;
+    };
+} // namespace rpf
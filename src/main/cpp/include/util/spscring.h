@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace rpf {
+    /*
+     * A lock-free single producer, single consumer ring buffer of fixed-size records.
+     *
+     * The producer never waits: if the ring is full, the record is dropped and counted instead.
+     * The consumer takes out as many records as it wants with a single call, which only has to
+     * do one or two memcpy()s.
+     *
+     * The head and tail are kept on separate cache lines, and the producer keeps a cached copy of
+     * the tail, so that the two sides only touch each other's cache line when the ring looks
+     * full.
+     */
+    template <typename T>
+    class SPSCRing {
+        static_assert(std::is_trivially_copyable<T>::value, "Records must be trivially copyable");
+
+    public:
+        // The capacity is rounded up to a power of 2
+        explicit SPSCRing(std::size_t capacity) {
+            std::size_t size = 1;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            mask = size - 1;
+            buffer.resize(size);
+        }
+
+        SPSCRing(const SPSCRing &) = delete;
+        SPSCRing &operator=(const SPSCRing &) = delete;
+
+        // Only to be called by the producer
+        // Returns false if the ring was full and the record was dropped
+        bool push(const T &record) {
+            std::size_t h = head.load(std::memory_order_relaxed);
+            if (h - tail_cache > mask) {
+                tail_cache = tail.load(std::memory_order_acquire);
+                if (h - tail_cache > mask) {
+                    dropped_count.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+            buffer[h & mask] = record;
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Only to be called by the consumer
+        // Moves up to max records into out, oldest first, and returns how many were moved
+        // out does not need to be aligned
+        std::size_t pop(void *out, std::size_t max) {
+            std::size_t t = tail.load(std::memory_order_relaxed);
+            std::size_t n = std::min(head.load(std::memory_order_acquire) - t, max);
+            // The records may wrap around the end of the buffer
+            std::size_t start = t & mask;
+            std::size_t first = std::min(n, buffer.size() - start);
+            std::memcpy(out, buffer.data() + start, first * sizeof(T));
+            std::memcpy(static_cast<char *>(out) + first * sizeof(T), buffer.data(),
+                    (n - first) * sizeof(T));
+            tail.store(t + n, std::memory_order_release);
+            return n;
+        }
+
+        // The number of records waiting to be popped
+        inline std::size_t size() const {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+        inline std::size_t capacity() const {
+            return buffer.size();
+        }
+        // The number of records dropped because the ring was full
+        inline std::uint64_t dropped() const {
+            return dropped_count.load(std::memory_order_relaxed);
+        }
+
+    protected:
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        std::vector<T> buffer;
+        std::size_t mask;
+
+        // Written by the producer
+        char pad0[CACHE_LINE];
+        std::atomic<std::size_t> head{0};
+        std::size_t tail_cache = 0;
+        std::atomic<std::uint64_t> dropped_count{0};
+        // Written by the consumer
+        char pad1[CACHE_LINE];
+        std::atomic<std::size_t> tail{0};
+        char pad2[CACHE_LINE];
+    };
+} // namespace rpf
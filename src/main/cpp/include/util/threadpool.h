@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rpf {
+    /*
+     * A fixed number of worker threads that run tasks in the order they were submitted.
+     *
+     * Tasks that have not started running when the pool is destroyed are discarded, so that
+     * shutting down does not have to wait for them. Instead of the task, its discard function is
+     * called once the workers have stopped, so that whatever is waiting for it can be finished.
+     */
+    class ThreadPool {
+    public:
+        // Throws std::invalid_argument if threads is 0
+        explicit ThreadPool(std::size_t threads);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        // discard is called instead of task if the pool is destroyed before task starts
+        void submit(std::function<void()> task, std::function<void()> discard = nullptr);
+
+        inline std::size_t size() const {
+            return workers.size();
+        }
+
+        // The pool used for asynchronous generation by default
+        // It has one thread less than the number of CPUs (but at least one), so that the thread
+        // that started the generation is not slowed down
+        static ThreadPool &shared();
+
+    protected:
+        struct Task {
+            std::function<void()> run;
+            std::function<void()> discard;
+        };
+
+        void run();
+
+        std::vector<std::thread> workers;
+        std::deque<Task> tasks;
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool stopping = false;
+    };
+} // namespace rpf
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+
+namespace rpf {
+    /*
+     * A lock-free single producer, single consumer slot that always holds the latest value.
+     *
+     * The writer and the reader each own one of three buffers, and the third one is swapped
+     * between them with a single atomic exchange. Neither side ever waits for the other, and the
+     * reader always gets the most recent complete value; older values are overwritten.
+     */
+    template <typename T>
+    class TripleBuffer {
+    public:
+        TripleBuffer() {
+        }
+        explicit TripleBuffer(const T &initial) {
+            for (int i = 0; i < 3; i++) {
+                buffers[i] = initial;
+            }
+        }
+
+        // Only to be called by the writer
+        void write(const T &value) {
+            buffers[back] = value;
+            back = middle.exchange(back | DIRTY, std::memory_order_acq_rel) & INDEX;
+        }
+
+        // Only to be called by the reader
+        // Returns the latest value, whether or not it was read before
+        const T &latest() {
+            if (middle.load(std::memory_order_relaxed) & DIRTY) {
+                front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+            }
+            return buffers[front];
+        }
+        // Only to be called by the reader
+        // Returns true and stores the value in out if there is a new value since the last read
+        bool read(T &out) {
+            if (!(middle.load(std::memory_order_relaxed) & DIRTY)) {
+                return false;
+            }
+            out = latest();
+            return true;
+        }
+
+    protected:
+        static constexpr unsigned INDEX = 3;
+        static constexpr unsigned DIRTY = 4;
+
+        T buffers[3];
+        // The index of the buffer in the middle, and whether it has a value the reader has not
+        // seen yet
+        std::atomic<unsigned> middle{1};
+        unsigned front = 0, back = 2;
+    };
+} // namespace rpf
@@ -0,0 +1,204 @@
+#include "follower/realtimerunner.h"
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+namespace rpf {
+
+    namespace {
+        // The current time of a monotonic clock in nanoseconds
+        std::int64_t now_ns() {
+#ifdef __linux__
+            timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<std::int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+#endif
+        }
+
+        // Sleeps until an absolute time of the clock used by now_ns()
+        void sleep_until_ns(std::int64_t deadline) {
+#ifdef __linux__
+            timespec ts;
+            ts.tv_sec = deadline / 1000000000;
+            ts.tv_nsec = deadline % 1000000000;
+            // Go back to sleep if interrupted by a signal
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+            }
+#else
+            std::this_thread::sleep_until(
+                    std::chrono::steady_clock::time_point(std::chrono::nanoseconds(deadline)));
+#endif
+        }
+
+        void update_max(std::atomic<std::int64_t> &max, std::int64_t value) {
+            std::int64_t prev = max.load(std::memory_order_relaxed);
+            while (value > prev &&
+                    !max.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        // Applies the priority and affinity to the calling thread
+        // Returns whether all of them were applied
+        bool apply_config(const RealTimeRunner::Config &config) {
+#ifdef __linux__
+            bool applied = true;
+            if (config.priority > 0) {
+                sched_param param;
+                param.sched_priority = config.priority;
+                applied &= pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+            }
+            if (config.cpu >= 0) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(config.cpu, &set);
+                applied &= pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+            }
+            return applied;
+#else
+            // Not supported on this platform
+            return config.priority <= 0 && config.cpu < 0;
+#endif
+        }
+    } // namespace
+
+    RealTimeRunner::RealTimeRunner(
+            std::shared_ptr<const TankDriveTrajectory> target, const TankDriveGains &gains)
+            : follower(target, gains) {
+    }
+    RealTimeRunner::RealTimeRunner(std::shared_ptr<const TankDriveTrajectory> target,
+            const TankDriveGains &gains, const Callbacks &callbacks)
+            : follower(target, gains), callbacks(callbacks) {
+    }
+
+    RealTimeRunner::~RealTimeRunner() {
+        stop();
+    }
+
+    void RealTimeRunner::start(const Config &config) {
+        if (!(config.frequency > 0)) {
+            throw std::invalid_argument("Frequency must be positive");
+        }
+        if (is_running()) {
+            throw std::logic_error("Runner is already running");
+        }
+        // The thread may have ended by itself after the trajectory finished
+        if (thread.joinable()) {
+            thread.join();
+        }
+
+        stop_requested.store(false, std::memory_order_relaxed);
+        finished.store(false, std::memory_order_relaxed);
+        iterations.store(0, std::memory_order_relaxed);
+        overruns.store(0, std::memory_order_relaxed);
+        jitter_sum.store(0, std::memory_order_relaxed);
+        max_jitter.store(0, std::memory_order_relaxed);
+        max_exec_time.store(0, std::memory_order_relaxed);
+        running.store(true, std::memory_order_release);
+
+        thread = std::thread(&RealTimeRunner::run, this, config);
+    }
+
+    void RealTimeRunner::stop() {
+        stop_requested.store(true, std::memory_order_release);
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    RealTimeRunner::Statistics RealTimeRunner::get_statistics() const {
+        Statistics stats;
+        stats.iterations = iterations.load(std::memory_order_relaxed);
+        stats.overruns = overruns.load(std::memory_order_relaxed);
+        if (stats.iterations > 0) {
+            stats.mean_jitter =
+                    jitter_sum.load(std::memory_order_relaxed) * 1e-9 / stats.iterations;
+        }
+        stats.max_jitter = max_jitter.load(std::memory_order_relaxed) * 1e-9;
+        stats.max_exec_time = max_exec_time.load(std::memory_order_relaxed) * 1e-9;
+        return stats;
+    }
+
+    void RealTimeRunner::set_telemetry(std::shared_ptr<TelemetryRing> telemetry) {
+        if (is_running()) {
+            throw std::logic_error("Telemetry cannot be changed while the runner is running");
+        }
+        follower.set_telemetry(telemetry);
+    }
+
+    void RealTimeRunner::read_feedback(Feedback &fb) {
+        if (callbacks.read_sensors) {
+            callbacks.read_sensors(callbacks.user, fb);
+        }
+        else {
+            fb = feedback.latest();
+        }
+    }
+
+    void RealTimeRunner::write_command(double left, double right, double timestamp) {
+        if (callbacks.set_motors) {
+            callbacks.set_motors(callbacks.user, left, right);
+        }
+        else {
+            Command c;
+            c.left = left;
+            c.right = right;
+            c.timestamp = timestamp;
+            command.write(c);
+        }
+    }
+
+    void RealTimeRunner::run(Config config) {
+        realtime.store(apply_config(config), std::memory_order_release);
+
+        const std::int64_t period = std::llround(1e9 / config.frequency);
+        std::int64_t deadline = now_ns();
+
+        Feedback fb;
+        read_feedback(fb);
+        follower.initialize(deadline * 1e-9, fb.l_pos, fb.r_pos, fb.direction);
+
+        bool done = false;
+        while (!stop_requested.load(std::memory_order_acquire)) {
+            // Deadlines are absolute, so the time taken by each iteration does not add up
+            deadline += period;
+            sleep_until_ns(deadline);
+            std::int64_t wake = now_ns();
+
+            read_feedback(fb);
+            double left, right;
+            done = follower.run(wake * 1e-9, fb.l_pos, fb.r_pos, fb.direction, left, right);
+            if (done) {
+                break;
+            }
+            write_command(left, right, wake * 1e-9);
+
+            std::int64_t end = now_ns();
+            iterations.fetch_add(1, std::memory_order_relaxed);
+            jitter_sum.fetch_add(wake - deadline, std::memory_order_relaxed);
+            update_max(max_jitter, wake - deadline);
+            update_max(max_exec_time, end - wake);
+            // If the iteration ran past the next deadline, skip the periods that were missed
+            // instead of running them back to back
+            if (end > deadline + period) {
+                overruns.fetch_add(1, std::memory_order_relaxed);
+                deadline += (end - deadline) / period * period;
+            }
+        }
+
+        // Stop the motors
+        write_command(0, 0, now_ns() * 1e-9);
+        finished.store(done, std::memory_order_release);
+        running.store(false, std::memory_order_release);
+    }
+} // namespace rpf
@@ -0,0 +1,66 @@
+#include "follower/tankdrivefollower.h"
+#include "math/rpfmath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace rpf {
+
+    void TankDriveFollower::initialize(
+            double timestamp, double l_pos, double r_pos, double direction) {
+        // Reset the initial distance, direction and timestamp references
+        l_init_pos = l_pos;
+        r_init_pos = r_pos;
+        init_direction = direction;
+        init_time = last_time = timestamp;
+        cursor = 0;
+
+        // Reset integrals and last errors
+        l_err_int = r_err_int = l_last_err = r_last_err = 0;
+    }
+
+    bool TankDriveFollower::run(double timestamp, double l_pos, double r_pos, double direction,
+            double &left, double &right) {
+        // Calculate current t and time difference from last iteration
+        double dt = timestamp - last_time;
+        double t = timestamp - init_time;
+        if (t > target->total_time()) {
+            return true;
+        }
+
+        moment = target->get(t, cursor);
+
+        l_err = r_err = l_deriv = r_deriv = dir_err = 0;
+        // Calculate errors and derivatives only if there are position readings
+        if (!std::isnan(l_pos) && !std::isnan(r_pos)) {
+            l_err = moment.l_pos - (l_pos - l_init_pos);
+            r_err = moment.r_pos - (r_pos - r_init_pos);
+            l_deriv = (l_err - l_last_err) / dt;
+            r_deriv = (r_err - r_last_err) / dt;
+            l_err_int += l_err * dt;
+            r_err_int += r_err * dt;
+        }
+        // Calculate directional error only if there is a direction reading
+        if (!std::isnan(direction)) {
+            // This angle diff will be positive if the robot needs to turn left
+            dir_err = angle_diff(direction - init_direction, moment.get_rfacing());
+        }
+        // Calculate outputs
+        l_out = gains.ka * moment.l_accel + gains.kv * moment.l_vel + gains.kp * l_err +
+                gains.ki * l_err_int + gains.kd * l_deriv - dir_err * gains.kdp;
+        r_out = gains.ka * moment.r_accel + gains.kv * moment.r_vel + gains.kp * r_err +
+                gains.ki * r_err_int + gains.kd * r_deriv + dir_err * gains.kdp;
+        // Constrain
+        left = l_out = std::max(-1.0, std::min(1.0, l_out));
+        right = r_out = std::max(-1.0, std::min(1.0, r_out));
+
+        last_time = timestamp;
+        l_last_err = l_err;
+        r_last_err = r_err;
+
+        if (telemetry) {
+            telemetry->push(FollowerTelemetry{timestamp, t, l_err, r_err, dir_err, l_err_int,
+                    r_err_int, l_deriv, r_deriv, l_out, r_out});
+        }
+        return false;
+    }
+} // namespace rpf
@@ -2,13 +2,16 @@
 #include "jni/instlists.h"
 #include "jni/jniutil.h"
 #include "trajectory/basictrajectory.h"
+#include "util/instrumentation.h"
 #include <algorithm>
 #include <vector>
 
 JNIEXPORT void JNICALL
 Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1construct(JNIEnv *env,
-        jobject obj, jdouble maxv, jdouble maxa, jdouble base_width, jboolean is_tank,
-        jobjectArray waypoints, jdouble alpha, jint sample_count, jint type) {
+        jobject obj, jdouble maxv, jdouble maxa, jdouble base_width, jdouble max_voltage, jdouble kv,
+        jdouble ka, jboolean is_tank, jobjectArray waypoints, jdouble alpha, jint sample_count,
+        jint type, jint generator) {
+    RPF_PROBE_BEGIN(marshal_probe, JNI_MARSHAL);
     rpf::TrajectoryParams params;
     params.waypoints.reserve(env->GetArrayLength(waypoints));
     // Translate the waypoints into C++ ones
@@ -19,11 +22,16 @@ Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1construct(
                 rpf::get_field<double>(env, waypoint, "heading"),
                 rpf::get_field<double>(env, waypoint, "velocity")));
     }
+    RPF_PROBE_END(marshal_probe);
 
     rpf::RobotSpecs specs(maxv, maxa, base_width);
+    specs.max_voltage = max_voltage;
+    specs.kv = kv;
+    specs.ka = ka;
     params.is_tank = is_tank;
     params.sample_count = sample_count;
     params.type = static_cast<rpf::PathType>(type);
+    params.generator = static_cast<rpf::GeneratorType>(generator);
     params.alpha = alpha;
 
     try {
@@ -40,6 +48,39 @@ Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1construct(
     }
 }
 
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1constructSampled(JNIEnv *env,
+        jobject obj, jobject sampled, jdouble maxv, jdouble maxa, jdouble base_width,
+        jdouble max_voltage, jdouble kv, jdouble ka) {
+    // The trajectory holds a reference to the parts of the sampled path it needs, so it stays
+    // valid even if the Java object is freed
+    auto geometry = rpf::find_instance(
+            spinstances, spinstances_mutex, rpf::get_obj_ptr<rpf::SampledPath>(env, sampled));
+    if (!geometry) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "The sampled path has already been freed");
+        return;
+    }
+
+    rpf::RobotSpecs specs(maxv, maxa, base_width);
+    specs.max_voltage = max_voltage;
+    specs.kv = kv;
+    specs.ka = ka;
+
+    try {
+        auto *t = new rpf::BasicTrajectory(specs, geometry);
+        {
+            // Acquire lock
+            std::lock_guard<std::mutex> lock(btinstances_mutex);
+            btinstances.push_back(std::shared_ptr<rpf::BasicTrajectory>(t));
+        }
+        rpf::set_obj_ptr(env, obj, t);
+    }
+    catch (const std::exception &e) {
+        rpf::throw_exception(env, rpf::EX_TrajectoryGenerationException, e.what());
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1destroy(
         JNIEnv *env, jobject obj) {
@@ -58,7 +99,7 @@ Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1getMoments
                 env, rpf::EX_IllegalStateException, "This object has already been freed");
     }
     else {
-        auto &moments = ptr->get_moments();
+        RPF_PROBE_SCOPE(JNI_MARSHAL);
 
         jclass clazz = env->GetObjectClass(obj);
         jfieldID fid = env->GetFieldID(clazz, "momentsCache",
@@ -70,10 +111,12 @@ Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1getMoments
                 env->FindClass("com/arctos6135/robotpathfinder/core/trajectory/BasicMoment");
         jmethodID constructor_mid = env->GetMethodID(mclass, "<init>", "(DDDDDDZ)V");
 
-        for (size_t i = 0; i < moments.size(); i++) {
-            jobject m = env->NewObject(mclass, constructor_mid, moments[i].pos, moments[i].vel,
-                    moments[i].accel, moments[i].heading, moments[i].time, moments[i].init_facing,
-                    moments[i].backwards);
+        for (size_t i = 0; i < ptr->moment_count(); i++) {
+            // Views of other trajectories transform the moments they share
+            auto moment = ptr->moment(i);
+            jobject m = env->NewObject(mclass, constructor_mid, moment.pos, moment.vel,
+                    moment.accel, moment.heading, moment.time, moment.init_facing,
+                    moment.backwards);
             env->SetObjectArrayElement(*arr, i, m);
         }
     }
@@ -210,6 +253,98 @@ Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1retrace(
     }
 }
 
+JNIEXPORT jlong JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1timeScaled(
+        JNIEnv *env, jobject obj, jdouble factor) {
+    auto p = rpf::get_obj_ptr<rpf::BasicTrajectory>(env, obj);
+    if (!rpf::check_instance(btinstances, btinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        try {
+            auto ptr = p->time_scaled(factor);
+            {
+                // Acquire lock to btinstances mutex
+                std::lock_guard<std::mutex> lock(btinstances_mutex);
+                btinstances.push_back(ptr);
+            }
+            return reinterpret_cast<jlong>(ptr.get());
+        }
+        catch (const std::invalid_argument &e) {
+            rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
+            return 0;
+        }
+    }
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1transformed(
+        JNIEnv *env, jobject obj, jdouble x, jdouble y, jdouble angle) {
+    auto p = rpf::get_obj_ptr<rpf::BasicTrajectory>(env, obj);
+    if (!rpf::check_instance(btinstances, btinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        auto ptr = p->transformed(rpf::RigidTransform(rpf::Vec2D(x, y), angle));
+        {
+            // Acquire lock to btinstances mutex
+            std::lock_guard<std::mutex> lock(btinstances_mutex);
+            btinstances.push_back(ptr);
+        }
+        return reinterpret_cast<jlong>(ptr.get());
+    }
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1anchoredAt(
+        JNIEnv *env, jobject obj, jdouble x, jdouble y, jdouble angle) {
+    auto p = rpf::get_obj_ptr<rpf::BasicTrajectory>(env, obj);
+    if (!rpf::check_instance(btinstances, btinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        auto ptr = p->anchored_at(rpf::Waypoint(x, y, angle));
+        {
+            // Acquire lock to btinstances mutex
+            std::lock_guard<std::mutex> lock(btinstances_mutex);
+            btinstances.push_back(ptr);
+        }
+        return reinterpret_cast<jlong>(ptr.get());
+    }
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1subtrajectory(
+        JNIEnv *env, jobject obj, jdouble t0, jdouble t1) {
+    auto p = rpf::get_obj_ptr<rpf::BasicTrajectory>(env, obj);
+    if (!rpf::check_instance(btinstances, btinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        try {
+            auto ptr = p->subtrajectory(t0, t1);
+            {
+                // Acquire lock to btinstances mutex
+                std::lock_guard<std::mutex> lock(btinstances_mutex);
+                btinstances.push_back(ptr);
+            }
+            return reinterpret_cast<jlong>(ptr.get());
+        }
+        catch (const std::invalid_argument &e) {
+            rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
+            return 0;
+        }
+    }
+}
+
 JNIEXPORT jint JNICALL
 Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1getMomentCount(
         JNIEnv *env, jobject obj) {
@@ -220,6 +355,6 @@ Java_com_arctos6135_robotpathfinder_core_trajectory_BasicTrajectory__1getMomentC
         return 0;
     }
     else {
-        return p->get_moments().size();
+        return p->moment_count();
     }
 }
@@ -0,0 +1,190 @@
+#include "jni/com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle.h"
+#include "jni/instlists.h"
+#include "jni/jniutil.h"
+#include "trajectory/asyncgeneration.h"
+#include "util/instrumentation.h"
+#include <vector>
+
+namespace {
+    // Gets the job, or throws an exception and returns null if it was freed
+    // This returns a shared_ptr so that the job stays alive while it is being waited on, even if
+    // the Java object is freed on another thread
+    std::shared_ptr<rpf::GenerationJob> get_job(JNIEnv *env, jobject obj) {
+        auto p = rpf::get_obj_ptr<rpf::GenerationJob>(env, obj);
+        auto job = rpf::find_instance(gjinstances, gjinstances_mutex, p);
+        if (!job) {
+            rpf::throw_exception(
+                    env, rpf::EX_IllegalStateException, "This object has already been freed");
+        }
+        return job;
+    }
+} // namespace
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1construct(JNIEnv *env,
+        jobject obj, jboolean tank, jdouble maxv, jdouble maxa, jdouble base_width,
+        jdouble max_voltage, jdouble kv, jdouble ka, jobjectArray waypoints, jdouble alpha,
+        jint sample_count, jint type, jint generator) {
+    RPF_PROBE_BEGIN(marshal_probe, JNI_MARSHAL);
+    std::vector<rpf::Waypoint> wp;
+    wp.reserve(env->GetArrayLength(waypoints));
+    // Translate the waypoints into C++ ones
+    for (int i = 0; i < env->GetArrayLength(waypoints); i++) {
+        auto waypoint = env->GetObjectArrayElement(waypoints, i);
+        wp.push_back(rpf::Waypoint(rpf::get_field<double>(env, waypoint, "x"),
+                rpf::get_field<double>(env, waypoint, "y"),
+                rpf::get_field<double>(env, waypoint, "heading"),
+                rpf::get_field<double>(env, waypoint, "velocity")));
+    }
+    RPF_PROBE_END(marshal_probe);
+
+    rpf::RobotSpecs specs(maxv, maxa, base_width);
+    specs.max_voltage = max_voltage;
+    specs.kv = kv;
+    specs.ka = ka;
+    rpf::TrajectoryParams params;
+    params.waypoints = std::move(wp);
+    params.is_tank = tank;
+    params.sample_count = sample_count;
+    params.type = static_cast<rpf::PathType>(type);
+    params.generator = static_cast<rpf::GeneratorType>(generator);
+    params.alpha = alpha;
+
+    // Generation errors are reported when the result is retrieved
+    std::shared_ptr<rpf::GenerationJob> job;
+    if (tank) {
+        job = rpf::AsyncTrajectory<rpf::TankDriveTrajectory>::start(specs, params);
+    }
+    else {
+        job = rpf::AsyncTrajectory<rpf::BasicTrajectory>::start(specs, params);
+    }
+    {
+        // Acquire lock
+        std::lock_guard<std::mutex> lock(gjinstances_mutex);
+        gjinstances.push_back(job);
+    }
+    rpf::set_obj_ptr(env, obj, job.get());
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1destroy(
+        JNIEnv *env, jobject obj) {
+    auto ptr = rpf::get_obj_ptr<rpf::GenerationJob>(env, obj);
+    rpf::set_obj_ptr<rpf::GenerationJob>(env, obj, nullptr);
+    // Nobody can get the result any more, so don't bother generating it
+    auto job = rpf::find_instance(gjinstances, gjinstances_mutex, ptr);
+    if (job) {
+        job->cancel();
+    }
+    // Remove an entry from the instances list
+    rpf::remove_instance(gjinstances, gjinstances_mutex, ptr);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1getStatus(
+        JNIEnv *env, jobject obj) {
+    auto job = get_job(env, obj);
+    if (!job) {
+        return 0;
+    }
+    return static_cast<jint>(job->get_status());
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle_cancel(
+        JNIEnv *env, jobject obj) {
+    auto job = get_job(env, obj);
+    if (!job) {
+        return false;
+    }
+    return job->cancel();
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1waitFor(
+        JNIEnv *env, jobject obj, jdouble timeout) {
+    auto job = get_job(env, obj);
+    if (!job) {
+        return false;
+    }
+    // A negative timeout waits forever
+    if (timeout < 0) {
+        job->wait();
+        return true;
+    }
+    return job->wait_for(timeout);
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle__1getResult(
+        JNIEnv *env, jobject obj) {
+    auto job = get_job(env, obj);
+    if (!job) {
+        return 0;
+    }
+    try {
+        // The trajectory is handed over to the Java side, which frees it like any other
+        if (auto b = std::dynamic_pointer_cast<rpf::AsyncTrajectory<rpf::BasicTrajectory>>(job)) {
+            auto t = b->get();
+            {
+                // Acquire lock
+                std::lock_guard<std::mutex> lock(btinstances_mutex);
+                btinstances.push_back(t);
+            }
+            return reinterpret_cast<jlong>(t.get());
+        }
+        auto t = std::dynamic_pointer_cast<rpf::AsyncTrajectory<rpf::TankDriveTrajectory>>(job)
+                         ->get();
+        {
+            // Acquire lock
+            std::lock_guard<std::mutex> lock(ttinstances_mutex);
+            ttinstances.push_back(t);
+        }
+        return reinterpret_cast<jlong>(t.get());
+    }
+    catch (const rpf::GenerationCancelled &e) {
+        rpf::throw_exception(env, rpf::EX_CancellationException, e.what());
+    }
+    catch (const std::exception &e) {
+        rpf::throw_exception(env, rpf::EX_TrajectoryGenerationException, e.what());
+    }
+    return 0;
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_GenerationHandle_onComplete(
+        JNIEnv *env, jobject obj, jobject callback) {
+    auto job = get_job(env, obj);
+    if (!job) {
+        return;
+    }
+    JavaVM *jvm;
+    env->GetJavaVM(&jvm);
+    // The callback may run on a pool thread after this call returns, so it needs a global reference
+    jobject cb = env->NewGlobalRef(callback);
+    job->on_complete([jvm, cb]() {
+        JNIEnv *cenv;
+        bool attached = false;
+        // The pool threads are not Java threads, so they have to be attached to call into Java
+        if (jvm->GetEnv(reinterpret_cast<void **>(&cenv), JNI_VERSION_1_8) == JNI_EDETACHED) {
+            if (jvm->AttachCurrentThreadAsDaemon(reinterpret_cast<void **>(&cenv), nullptr)
+                    != JNI_OK) {
+                return;
+            }
+            attached = true;
+        }
+
+        jmethodID mid = cenv->GetMethodID(cenv->GetObjectClass(cb), "run", "()V");
+        cenv->CallVoidMethod(cb, mid);
+        // There is nobody to throw the exception to, so just report it
+        if (cenv->ExceptionCheck()) {
+            cenv->ExceptionDescribe();
+            cenv->ExceptionClear();
+        }
+        cenv->DeleteGlobalRef(cb);
+
+        if (attached) {
+            jvm->DetachCurrentThread();
+        }
+    });
+}
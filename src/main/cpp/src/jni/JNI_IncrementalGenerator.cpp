@@ -0,0 +1,150 @@
+#include "jni/com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator.h"
+#include "jni/instlists.h"
+#include "jni/jniutil.h"
+#include "trajectory/incrementalgenerator.h"
+#include "util/instrumentation.h"
+#include <vector>
+
+namespace {
+    // Gets the generator, or throws an exception and returns null if it was freed
+    // This returns a shared_ptr so that the generator stays alive while it is stepping, even if
+    // the Java object is freed on another thread
+    std::shared_ptr<rpf::IncrementalGenerator> get_gen(JNIEnv *env, jobject obj) {
+        auto p = rpf::get_obj_ptr<rpf::IncrementalGenerator>(env, obj);
+        auto gen = rpf::find_instance(iginstances, iginstances_mutex, p);
+        if (!gen) {
+            rpf::throw_exception(
+                    env, rpf::EX_IllegalStateException, "This object has already been freed");
+        }
+        return gen;
+    }
+} // namespace
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1construct(JNIEnv *env,
+        jobject obj, jboolean tank, jboolean streaming, jdouble maxv, jdouble maxa,
+        jdouble base_width, jdouble max_voltage, jdouble kv, jdouble ka, jobjectArray waypoints,
+        jdouble alpha, jint sample_count, jint type, jint generator) {
+    RPF_PROBE_BEGIN(marshal_probe, JNI_MARSHAL);
+    std::vector<rpf::Waypoint> wp;
+    wp.reserve(env->GetArrayLength(waypoints));
+    // Translate the waypoints into C++ ones
+    for (int i = 0; i < env->GetArrayLength(waypoints); i++) {
+        auto waypoint = env->GetObjectArrayElement(waypoints, i);
+        wp.push_back(rpf::Waypoint(rpf::get_field<double>(env, waypoint, "x"),
+                rpf::get_field<double>(env, waypoint, "y"),
+                rpf::get_field<double>(env, waypoint, "heading"),
+                rpf::get_field<double>(env, waypoint, "velocity")));
+    }
+    RPF_PROBE_END(marshal_probe);
+
+    rpf::RobotSpecs specs(maxv, maxa, base_width);
+    specs.max_voltage = max_voltage;
+    specs.kv = kv;
+    specs.ka = ka;
+    rpf::TrajectoryParams params;
+    params.waypoints = std::move(wp);
+    params.is_tank = tank;
+    params.sample_count = sample_count;
+    params.type = static_cast<rpf::PathType>(type);
+    params.generator = static_cast<rpf::GeneratorType>(generator);
+    params.alpha = alpha;
+
+    try {
+        auto *g = new rpf::IncrementalGenerator(specs, params, tank, streaming);
+        {
+            // Acquire lock
+            std::lock_guard<std::mutex> lock(iginstances_mutex);
+            iginstances.push_back(std::shared_ptr<rpf::IncrementalGenerator>(g));
+        }
+        rpf::set_obj_ptr(env, obj, g);
+    }
+    catch (const std::exception &e) {
+        rpf::throw_exception(env, rpf::EX_TrajectoryGenerationException, e.what());
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1destroy(
+        JNIEnv *env, jobject obj) {
+    auto ptr = rpf::get_obj_ptr<rpf::IncrementalGenerator>(env, obj);
+    rpf::set_obj_ptr<rpf::IncrementalGenerator>(env, obj, nullptr);
+    // Remove an entry from the instances list
+    rpf::remove_instance(iginstances, iginstances_mutex, ptr);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1step(
+        JNIEnv *env, jobject obj, jdouble budget_us) {
+    auto gen = get_gen(env, obj);
+    if (!gen) {
+        return false;
+    }
+    try {
+        return gen->step(budget_us);
+    }
+    catch (const std::exception &e) {
+        rpf::throw_exception(env, rpf::EX_TrajectoryGenerationException, e.what());
+    }
+    return false;
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_getProgress(
+        JNIEnv *env, jobject obj) {
+    auto gen = get_gen(env, obj);
+    return gen ? gen->progress() : 0;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_isDone(
+        JNIEnv *env, jobject obj) {
+    auto gen = get_gen(env, obj);
+    return gen ? gen->is_done() : false;
+}
+
+JNIEXPORT jint JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_getAvailableCount(
+        JNIEnv *env, jobject obj) {
+    auto gen = get_gen(env, obj);
+    return gen ? static_cast<jint>(gen->available()) : 0;
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator_getAvailableTime(
+        JNIEnv *env, jobject obj) {
+    auto gen = get_gen(env, obj);
+    return gen ? gen->available_time() : 0;
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_arctos6135_robotpathfinder_core_trajectory_IncrementalGenerator__1getResult(
+        JNIEnv *env, jobject obj) {
+    auto gen = get_gen(env, obj);
+    if (!gen) {
+        return 0;
+    }
+    try {
+        // The trajectory is handed over to the Java side, which frees it like any other
+        if (!gen->is_tank()) {
+            auto t = gen->get_basic();
+            {
+                // Acquire lock
+                std::lock_guard<std::mutex> lock(btinstances_mutex);
+                btinstances.push_back(t);
+            }
+            return reinterpret_cast<jlong>(t.get());
+        }
+        auto t = gen->get_tank();
+        {
+            // Acquire lock
+            std::lock_guard<std::mutex> lock(ttinstances_mutex);
+            ttinstances.push_back(t);
+        }
+        return reinterpret_cast<jlong>(t.get());
+    }
+    catch (const std::exception &e) {
+        rpf::throw_exception(env, rpf::EX_TrajectoryGenerationException, e.what());
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "jni/com_arctos6135_robotpathfinder_core_Instrumentation.h"
+#include "util/instrumentation.h"
+#include <cstddef>
+
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_core_Instrumentation_isEnabled(
+        JNIEnv *, jclass) {
+    return rpf::probes_enabled();
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_arctos6135_robotpathfinder_core_Instrumentation_snapshot(
+        JNIEnv *env, jclass) {
+    auto snapshot = rpf::probe_snapshot();
+
+    jclass sclass =
+            env->FindClass("com/arctos6135/robotpathfinder/core/Instrumentation$ProbeStats");
+    jmethodID constructor_mid =
+            env->GetMethodID(sclass, "<init>", "(Ljava/lang/String;JDDDDD)V");
+    jobjectArray arr = env->NewObjectArray(snapshot.size(), sclass, nullptr);
+    for (std::size_t i = 0; i < snapshot.size(); i++) {
+        const auto &s = snapshot[i];
+        jstring name = env->NewStringUTF(rpf::probe_name(s.probe));
+        jobject stats = env->NewObject(sclass, constructor_mid, name,
+                static_cast<jlong>(s.count), s.total, s.min, s.max, s.p50, s.p99);
+        env->SetObjectArrayElement(arr, i, stats);
+        env->DeleteLocalRef(name);
+        env->DeleteLocalRef(stats);
+    }
+    return arr;
+}
+
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_Instrumentation_reset(
+        JNIEnv *, jclass) {
+    rpf::reset_probes();
+}
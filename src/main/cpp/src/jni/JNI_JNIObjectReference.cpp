@@ -22,4 +22,32 @@ Java_com_arctos6135_robotpathfinder_core_lifecycle_JNIObjectReference__1freeObje
                 reinterpret_cast<rpf::TankDriveTrajectory *>(ptr))) {
         return;
     }
+    if (rpf::remove_instance(tmpinstances, tmpinstances_mutex,
+                reinterpret_cast<rpf::TrapezoidalMotionProfile *>(ptr))) {
+        return;
+    }
+    if (rpf::remove_instance(tdfinstances, tdfinstances_mutex,
+                reinterpret_cast<rpf::TankDriveFollower *>(ptr))) {
+        return;
+    }
+    if (rpf::remove_instance(rtrinstances, rtrinstances_mutex,
+                reinterpret_cast<rpf::RealTimeRunner *>(ptr))) {
+        return;
+    }
+    if (rpf::remove_instance(telinstances, telinstances_mutex,
+                reinterpret_cast<rpf::TelemetryRing *>(ptr))) {
+        return;
+    }
+    if (rpf::remove_instance(gjinstances, gjinstances_mutex,
+                reinterpret_cast<rpf::GenerationJob *>(ptr))) {
+        return;
+    }
+    if (rpf::remove_instance(iginstances, iginstances_mutex,
+                reinterpret_cast<rpf::IncrementalGenerator *>(ptr))) {
+        return;
+    }
+    if (rpf::remove_instance(
+                spinstances, spinstances_mutex, reinterpret_cast<rpf::SampledPath *>(ptr))) {
+        return;
+    }
 }
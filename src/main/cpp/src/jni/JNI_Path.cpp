@@ -3,6 +3,7 @@
 #include "jni/jniutil.h"
 #include "paths.h"
 #include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1construct(
@@ -17,14 +18,20 @@ JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1cons
                 rpf::get_field<double>(env, waypoint, "heading")));
     }
 
-    rpf::Path *path = new rpf::Path(wp, alpha, static_cast<rpf::PathType>(type));
-    {
-        // Acquire lock
-        std::lock_guard<std::mutex> lock(pinstances_mutex);
-        // Add the newly created path to the instances list
-        pinstances.push_back(std::shared_ptr<rpf::Path>(path));
+    try {
+        rpf::Path *path = new rpf::Path(wp, alpha, static_cast<rpf::PathType>(type));
+        {
+            // Acquire lock
+            std::lock_guard<std::mutex> lock(pinstances_mutex);
+            // Add the newly created path to the instances list
+            pinstances.push_back(std::shared_ptr<rpf::Path>(path));
+        }
+        rpf::set_obj_ptr(env, obj, path);
+    }
+    catch (const std::invalid_argument &e) {
+        // Some path types cannot be fitted to every set of waypoints
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
     }
-    rpf::set_obj_ptr(env, obj, path);
 }
 
 JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1destroy(
@@ -128,6 +135,80 @@ JNIEXPORT jobject JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_whe
     }
 }
 
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureAt(
+        JNIEnv *env, jobject obj, jdouble t) {
+    auto ptr = rpf::get_obj_ptr<rpf::Path>(env, obj);
+    if (!rpf::check_instance(pinstances, pinstances_mutex, ptr)) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        return ptr->curvature_at(t);
+    }
+}
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureDerivAt(
+        JNIEnv *env, jobject obj, jdouble t) {
+    auto ptr = rpf::get_obj_ptr<rpf::Path>(env, obj);
+    if (!rpf::check_instance(pinstances, pinstances_mutex, ptr)) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        return ptr->curvature_deriv_at(t);
+    }
+}
+JNIEXPORT jdoubleArray JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvaturesAt(
+        JNIEnv *env, jobject obj, jdoubleArray times) {
+    auto ptr = rpf::get_obj_ptr<rpf::Path>(env, obj);
+    if (!rpf::check_instance(pinstances, pinstances_mutex, ptr)) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return NULL;
+    }
+    else {
+        // Copy the times in and the results out in bulk instead of one call per element
+        jsize len = env->GetArrayLength(times);
+        std::vector<double> t(len);
+        env->GetDoubleArrayRegion(times, 0, len, t.data());
+        std::vector<double> out;
+        ptr->curvature_at(t, out);
+
+        jdoubleArray result = env->NewDoubleArray(len);
+        env->SetDoubleArrayRegion(result, 0, len, out.data());
+        return result;
+    }
+}
+JNIEXPORT jdoubleArray JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureDerivsAt(
+        JNIEnv *env, jobject obj, jdoubleArray times) {
+    auto ptr = rpf::get_obj_ptr<rpf::Path>(env, obj);
+    if (!rpf::check_instance(pinstances, pinstances_mutex, ptr)) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return NULL;
+    }
+    else {
+        // Copy the times in and the results out in bulk instead of one call per element
+        jsize len = env->GetArrayLength(times);
+        std::vector<double> t(len);
+        env->GetDoubleArrayRegion(times, 0, len, t.data());
+        std::vector<double> out;
+        ptr->curvature_deriv_at(t, out);
+
+        jdoubleArray result = env->NewDoubleArray(len);
+        env->SetDoubleArrayRegion(result, 0, len, out.data());
+        return result;
+    }
+}
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path_curvatureBoundAt(
+        JNIEnv *env, jobject obj, jdouble t) {
+    auto ptr = rpf::get_obj_ptr<rpf::Path>(env, obj);
+    if (!rpf::check_instance(pinstances, pinstances_mutex, ptr)) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        return ptr->curvature_bound_at(t);
+    }
+}
+
 JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1computeLen(
         JNIEnv *env, jobject obj, jint points) {
     auto ptr = rpf::get_obj_ptr<rpf::Path>(env, obj);
@@ -214,6 +295,25 @@ JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1ret
     }
 }
 
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1transformed(
+        JNIEnv *env, jobject obj, jdouble x, jdouble y, jdouble angle) {
+    auto p = rpf::get_obj_ptr<rpf::Path>(env, obj);
+    if (!rpf::check_instance(pinstances, pinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        auto ptr = p->transformed(rpf::RigidTransform(rpf::Vec2D(x, y), angle));
+        {
+            // Acquire lock
+            std::lock_guard<std::mutex> lock(pinstances_mutex);
+            pinstances.push_back(ptr);
+        }
+        return reinterpret_cast<jlong>(ptr.get());
+    }
+}
+
 JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_path_Path__1updateWaypoints(
         JNIEnv *env, jobject obj) {
     auto p = rpf::get_obj_ptr<rpf::Path>(env, obj);
@@ -0,0 +1,192 @@
+#include "jni/com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner.h"
+#include "follower/realtimerunner.h"
+#include "jni/instlists.h"
+#include "jni/jniutil.h"
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+    // Gets the runner, or throws an exception and returns null if it was freed
+    rpf::RealTimeRunner *get_runner(JNIEnv *env, jobject obj) {
+        auto p = rpf::get_obj_ptr<rpf::RealTimeRunner>(env, obj);
+        if (!rpf::check_instance(rtrinstances, rtrinstances_mutex, p)) {
+            rpf::throw_exception(
+                    env, rpf::EX_IllegalStateException, "This object has already been freed");
+            return nullptr;
+        }
+        return p;
+    }
+} // namespace
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1construct(JNIEnv *env,
+        jobject obj, jobject target, jdouble kv, jdouble ka, jdouble kp, jdouble ki, jdouble kd,
+        jdouble kdp) {
+    auto tptr = rpf::get_obj_ptr<rpf::TankDriveTrajectory>(env, target);
+    std::shared_ptr<rpf::TankDriveTrajectory> traj;
+    {
+        // Acquire lock to ttinstances mutex
+        // The runner holds a reference to the trajectory, so it stays valid even if the Java
+        // object is freed while the thread is running
+        std::lock_guard<std::mutex> lock(ttinstances_mutex);
+        auto it = std::find_if(ttinstances.begin(), ttinstances.end(),
+                [&](const auto &p) { return p.get() == tptr; });
+        if (it != ttinstances.end()) {
+            traj = *it;
+        }
+    }
+    if (!traj) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "The trajectory has already been freed");
+        return;
+    }
+
+    rpf::RealTimeRunner *r =
+            new rpf::RealTimeRunner(traj, rpf::TankDriveGains(kv, ka, kp, ki, kd, kdp));
+    {
+        // Acquire lock to rtrinstances mutex
+        std::lock_guard<std::mutex> lock(rtrinstances_mutex);
+        rtrinstances.push_back(std::shared_ptr<rpf::RealTimeRunner>(r));
+    }
+    rpf::set_obj_ptr(env, obj, r);
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1destroy(
+        JNIEnv *env, jobject obj) {
+    auto ptr = rpf::get_obj_ptr<rpf::RealTimeRunner>(env, obj);
+    rpf::set_obj_ptr<rpf::RealTimeRunner>(env, obj, nullptr);
+    // Remove an entry from the instances list
+    // This also stops the thread if it is still running
+    rpf::remove_instance(rtrinstances, rtrinstances_mutex, ptr);
+}
+
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1start(
+        JNIEnv *env, jobject obj, jdouble frequency, jint priority, jint cpu) {
+    auto p = get_runner(env, obj);
+    if (!p) {
+        return;
+    }
+    rpf::RealTimeRunner::Config config;
+    config.frequency = frequency;
+    config.priority = priority;
+    config.cpu = cpu;
+    try {
+        p->start(config);
+    }
+    catch (const std::invalid_argument &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
+    }
+    catch (const std::logic_error &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, e.what());
+    }
+    catch (const std::system_error &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, e.what());
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_stop(
+        JNIEnv *env, jobject obj) {
+    auto p = get_runner(env, obj);
+    if (p) {
+        p->stop();
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_isRunning(
+        JNIEnv *env, jobject obj) {
+    auto p = get_runner(env, obj);
+    return p ? p->is_running() : false;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_isFinished(
+        JNIEnv *env, jobject obj) {
+    auto p = get_runner(env, obj);
+    return p ? p->is_finished() : false;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_isRealTime(
+        JNIEnv *env, jobject obj) {
+    auto p = get_runner(env, obj);
+    return p ? p->is_realtime() : false;
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_pushFeedback(
+        JNIEnv *env, jobject obj, jdouble l_pos, jdouble r_pos, jdouble direction) {
+    auto p = get_runner(env, obj);
+    if (p) {
+        rpf::RealTimeRunner::Feedback fb;
+        fb.l_pos = l_pos;
+        fb.r_pos = r_pos;
+        fb.direction = direction;
+        p->push_feedback(fb);
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_pollCommand(
+        JNIEnv *env, jobject obj, jdoubleArray outputs) {
+    auto p = get_runner(env, obj);
+    if (!p) {
+        return false;
+    }
+    if (env->GetArrayLength(outputs) < 3) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, "Output array is too short");
+        return false;
+    }
+
+    rpf::RealTimeRunner::Command c;
+    if (!p->poll_command(c)) {
+        return false;
+    }
+    double out[3] = {c.left, c.right, c.timestamp};
+    env->SetDoubleArrayRegion(outputs, 0, 3, out);
+    return true;
+}
+
+JNIEXPORT jobject JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner_getStatistics(
+        JNIEnv *env, jobject obj) {
+    auto p = get_runner(env, obj);
+    if (!p) {
+        return NULL;
+    }
+    auto stats = p->get_statistics();
+    jclass sclass = env->FindClass(
+            "com/arctos6135/robotpathfinder/follower/RealTimeFollowerRunner$Statistics");
+    jmethodID constructor_mid = env->GetMethodID(sclass, "<init>", "(JJDDD)V");
+
+    return env->NewObject(sclass, constructor_mid, static_cast<jlong>(stats.iterations),
+            static_cast<jlong>(stats.overruns), stats.mean_jitter, stats.max_jitter,
+            stats.max_exec_time);
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_RealTimeFollowerRunner__1setTelemetry(
+        JNIEnv *env, jobject obj, jobject telemetry) {
+    auto p = get_runner(env, obj);
+    if (!p) {
+        return;
+    }
+    std::shared_ptr<rpf::TelemetryRing> ring;
+    if (telemetry) {
+        ring = rpf::find_instance(telinstances, telinstances_mutex,
+                rpf::get_obj_ptr<rpf::TelemetryRing>(env, telemetry));
+        if (!ring) {
+            rpf::throw_exception(env, rpf::EX_IllegalStateException,
+                    "The telemetry buffer has already been freed");
+            return;
+        }
+    }
+    try {
+        p->set_telemetry(ring);
+    }
+    catch (const std::logic_error &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalStateException, e.what());
+    }
+}
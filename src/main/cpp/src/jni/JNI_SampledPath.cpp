@@ -0,0 +1,64 @@
+#include "jni/com_arctos6135_robotpathfinder_core_trajectory_SampledPath.h"
+#include "jni/instlists.h"
+#include "jni/jniutil.h"
+#include "trajectory/sampledpath.h"
+#include "util/instrumentation.h"
+#include <vector>
+
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_SampledPath__1construct(
+        JNIEnv *env, jobject obj, jobjectArray waypoints, jdouble alpha, jint sample_count,
+        jint type, jint generator, jboolean is_tank, jdouble base_width) {
+    RPF_PROBE_BEGIN(marshal_probe, JNI_MARSHAL);
+    rpf::TrajectoryParams params;
+    params.waypoints.reserve(env->GetArrayLength(waypoints));
+    // Translate the waypoints into C++ ones
+    for (int i = 0; i < env->GetArrayLength(waypoints); i++) {
+        auto waypoint = env->GetObjectArrayElement(waypoints, i);
+        params.waypoints.push_back(rpf::Waypoint(rpf::get_field<double>(env, waypoint, "x"),
+                rpf::get_field<double>(env, waypoint, "y"),
+                rpf::get_field<double>(env, waypoint, "heading"),
+                rpf::get_field<double>(env, waypoint, "velocity")));
+    }
+    RPF_PROBE_END(marshal_probe);
+
+    params.is_tank = is_tank;
+    params.sample_count = sample_count;
+    params.type = static_cast<rpf::PathType>(type);
+    params.generator = static_cast<rpf::GeneratorType>(generator);
+    params.alpha = alpha;
+
+    try {
+        auto *p = new rpf::SampledPath(params, base_width);
+        {
+            // Acquire lock
+            std::lock_guard<std::mutex> lock(spinstances_mutex);
+            spinstances.push_back(std::shared_ptr<rpf::SampledPath>(p));
+        }
+        rpf::set_obj_ptr(env, obj, p);
+    }
+    catch (const std::exception &e) {
+        rpf::throw_exception(env, rpf::EX_TrajectoryGenerationException, e.what());
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_SampledPath__1destroy(
+        JNIEnv *env, jobject obj) {
+    auto ptr = rpf::get_obj_ptr<rpf::SampledPath>(env, obj);
+    rpf::set_obj_ptr<rpf::SampledPath>(env, obj, nullptr);
+    // Remove an entry from the instances list
+    // Trajectories generated from it keep their own references to the parts they need
+    rpf::remove_instance(spinstances, spinstances_mutex, ptr);
+}
+
+JNIEXPORT jdouble JNICALL Java_com_arctos6135_robotpathfinder_core_trajectory_SampledPath_getLength(
+        JNIEnv *env, jobject obj) {
+    auto p = rpf::get_obj_ptr<rpf::SampledPath>(env, obj);
+    if (!rpf::check_instance(spinstances, spinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        return p->get_length();
+    }
+}
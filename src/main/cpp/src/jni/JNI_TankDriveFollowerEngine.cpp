@@ -0,0 +1,204 @@
+#include "jni/com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine.h"
+#include "follower/tankdrivefollower.h"
+#include "jni/instlists.h"
+#include "jni/jniutil.h"
+#include <algorithm>
+
+namespace {
+    // Gets the value of a member of the follower, or throws an exception if it was freed
+    jdouble get_state(JNIEnv *env, jobject obj, double rpf::TankDriveFollower::*member) {
+        auto p = rpf::get_obj_ptr<rpf::TankDriveFollower>(env, obj);
+        if (!rpf::check_instance(tdfinstances, tdfinstances_mutex, p)) {
+            rpf::throw_exception(
+                    env, rpf::EX_IllegalStateException, "This object has already been freed");
+            return 0;
+        }
+        return p->*member;
+    }
+} // namespace
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1construct(JNIEnv *env,
+        jobject obj, jobject target, jdouble kv, jdouble ka, jdouble kp, jdouble ki, jdouble kd,
+        jdouble kdp) {
+    auto tptr = rpf::get_obj_ptr<rpf::TankDriveTrajectory>(env, target);
+    std::shared_ptr<rpf::TankDriveTrajectory> traj;
+    {
+        // Acquire lock to ttinstances mutex
+        // The follower holds a reference to the trajectory, so it stays valid even if the Java
+        // object is freed
+        std::lock_guard<std::mutex> lock(ttinstances_mutex);
+        auto it = std::find_if(ttinstances.begin(), ttinstances.end(),
+                [&](const auto &p) { return p.get() == tptr; });
+        if (it != ttinstances.end()) {
+            traj = *it;
+        }
+    }
+    if (!traj) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "The trajectory has already been freed");
+        return;
+    }
+
+    rpf::TankDriveFollower *f =
+            new rpf::TankDriveFollower(traj, rpf::TankDriveGains(kv, ka, kp, ki, kd, kdp));
+    {
+        // Acquire lock to tdfinstances mutex
+        std::lock_guard<std::mutex> lock(tdfinstances_mutex);
+        tdfinstances.push_back(std::shared_ptr<rpf::TankDriveFollower>(f));
+    }
+    rpf::set_obj_ptr(env, obj, f);
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1destroy(
+        JNIEnv *env, jobject obj) {
+    auto ptr = rpf::get_obj_ptr<rpf::TankDriveFollower>(env, obj);
+    rpf::set_obj_ptr<rpf::TankDriveFollower>(env, obj, nullptr);
+    // Remove an entry from the instances list
+    rpf::remove_instance(tdfinstances, tdfinstances_mutex, ptr);
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1setGains(JNIEnv *env,
+        jobject obj, jdouble kv, jdouble ka, jdouble kp, jdouble ki, jdouble kd, jdouble kdp) {
+    auto p = rpf::get_obj_ptr<rpf::TankDriveFollower>(env, obj);
+    if (!rpf::check_instance(tdfinstances, tdfinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+    }
+    else {
+        p->set_gains(rpf::TankDriveGains(kv, ka, kp, ki, kd, kdp));
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine__1setTelemetry(
+        JNIEnv *env, jobject obj, jobject telemetry) {
+    auto p = rpf::get_obj_ptr<rpf::TankDriveFollower>(env, obj);
+    if (!rpf::check_instance(tdfinstances, tdfinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return;
+    }
+    std::shared_ptr<rpf::TelemetryRing> ring;
+    if (telemetry) {
+        ring = rpf::find_instance(telinstances, telinstances_mutex,
+                rpf::get_obj_ptr<rpf::TelemetryRing>(env, telemetry));
+        if (!ring) {
+            rpf::throw_exception(env, rpf::EX_IllegalStateException,
+                    "The telemetry buffer has already been freed");
+            return;
+        }
+    }
+    p->set_telemetry(ring);
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_initialize(JNIEnv *env,
+        jobject obj, jdouble timestamp, jdouble l_pos, jdouble r_pos, jdouble direction) {
+    auto p = rpf::get_obj_ptr<rpf::TankDriveFollower>(env, obj);
+    if (!rpf::check_instance(tdfinstances, tdfinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+    }
+    else {
+        p->initialize(timestamp, l_pos, r_pos, direction);
+    }
+}
+
+JNIEXPORT jboolean JNICALL Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_run(
+        JNIEnv *env, jobject obj, jdouble timestamp, jdouble l_pos, jdouble r_pos,
+        jdouble direction, jdoubleArray outputs) {
+    auto p = rpf::get_obj_ptr<rpf::TankDriveFollower>(env, obj);
+    if (!rpf::check_instance(tdfinstances, tdfinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return false;
+    }
+    if (env->GetArrayLength(outputs) < 2) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, "Output array is too short");
+        return false;
+    }
+
+    double out[2];
+    if (p->run(timestamp, l_pos, r_pos, direction, out[0], out[1])) {
+        return true;
+    }
+    env->SetDoubleArrayRegion(outputs, 0, 2, out);
+    return false;
+}
+
+JNIEXPORT jobject JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastMoment(
+        JNIEnv *env, jobject obj) {
+    auto p = rpf::get_obj_ptr<rpf::TankDriveFollower>(env, obj);
+    if (!rpf::check_instance(tdfinstances, tdfinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return NULL;
+    }
+    else {
+        auto &m = p->last_moment();
+        jclass mclass =
+                env->FindClass("com/arctos6135/robotpathfinder/core/trajectory/TankDriveMoment");
+        jmethodID constructor_mid = env->GetMethodID(mclass, "<init>", "(DDDDDDDDDZ)V");
+
+        return env->NewObject(mclass, constructor_mid, m.l_pos, m.r_pos, m.l_vel, m.r_vel,
+                m.l_accel, m.r_accel, m.heading, m.time, m.init_facing, m.backwards);
+    }
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftError(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::l_err);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightError(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::r_err);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastDirectionalError(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::dir_err);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftIntegral(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::l_err_int);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightIntegral(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::r_err_int);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftDerivative(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::l_deriv);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightDerivative(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::r_deriv);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastLeftOutput(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::l_out);
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_follower_TankDriveFollowerEngine_lastRightOutput(
+        JNIEnv *env, jobject obj) {
+    return get_state(env, obj, &rpf::TankDriveFollower::r_out);
+}
@@ -0,0 +1,76 @@
+#include "jni/com_arctos6135_robotpathfinder_follower_TelemetryBuffer.h"
+#include "follower/telemetry.h"
+#include "jni/instlists.h"
+#include "jni/jniutil.h"
+
+namespace {
+    // Gets the ring, or throws an exception and returns null if it was freed
+    rpf::TelemetryRing *get_ring(JNIEnv *env, jobject obj) {
+        auto p = rpf::get_obj_ptr<rpf::TelemetryRing>(env, obj);
+        if (!rpf::check_instance(telinstances, telinstances_mutex, p)) {
+            rpf::throw_exception(
+                    env, rpf::EX_IllegalStateException, "This object has already been freed");
+            return nullptr;
+        }
+        return p;
+    }
+} // namespace
+
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer__1construct(
+        JNIEnv *env, jobject obj, jint capacity) {
+    if (capacity <= 0) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, "Capacity must be positive");
+        return;
+    }
+    rpf::TelemetryRing *r = new rpf::TelemetryRing(capacity);
+    {
+        // Acquire lock to telinstances mutex
+        std::lock_guard<std::mutex> lock(telinstances_mutex);
+        telinstances.push_back(std::shared_ptr<rpf::TelemetryRing>(r));
+    }
+    rpf::set_obj_ptr(env, obj, r);
+}
+
+JNIEXPORT void JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer__1destroy(
+        JNIEnv *env, jobject obj) {
+    auto ptr = rpf::get_obj_ptr<rpf::TelemetryRing>(env, obj);
+    rpf::set_obj_ptr<rpf::TelemetryRing>(env, obj, nullptr);
+    // Remove an entry from the instances list
+    // Followers that still record into the ring keep their own reference to it
+    rpf::remove_instance(telinstances, telinstances_mutex, ptr);
+}
+
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer__1drain(
+        JNIEnv *env, jobject obj, jobject buffer, jint position, jint remaining) {
+    auto p = get_ring(env, obj);
+    if (!p) {
+        return 0;
+    }
+    char *address = static_cast<char *>(env->GetDirectBufferAddress(buffer));
+    if (!address) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalArgumentException, "The buffer must be a direct buffer");
+        return 0;
+    }
+    // Copy straight into the memory of the buffer
+    return static_cast<jint>(p->pop(
+            address + position, remaining / sizeof(rpf::FollowerTelemetry)));
+}
+
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer_size(
+        JNIEnv *env, jobject obj) {
+    auto p = get_ring(env, obj);
+    return p ? static_cast<jint>(p->size()) : 0;
+}
+
+JNIEXPORT jint JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer_capacity(
+        JNIEnv *env, jobject obj) {
+    auto p = get_ring(env, obj);
+    return p ? static_cast<jint>(p->capacity()) : 0;
+}
+
+JNIEXPORT jlong JNICALL Java_com_arctos6135_robotpathfinder_follower_TelemetryBuffer_dropped(
+        JNIEnv *env, jobject obj) {
+    auto p = get_ring(env, obj);
+    return p ? static_cast<jlong>(p->dropped()) : 0;
+}
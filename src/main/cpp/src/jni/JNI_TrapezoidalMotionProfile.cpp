@@ -0,0 +1,189 @@
+#include "jni/com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile.h"
+#include "jni/instlists.h"
+#include "jni/jniutil.h"
+#include "motionprofile/trapezoidalmotionprofile.h"
+#include <stdexcept>
+#include <vector>
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile__1construct(
+        JNIEnv *env, jobject obj, jdouble maxv, jdouble maxa, jdouble dist, jdouble init_vel) {
+    rpf::TrapezoidalMotionProfile *p =
+            new rpf::TrapezoidalMotionProfile(rpf::RobotSpecs(maxv, maxa), dist, init_vel);
+    {
+        // Acquire lock to tmpinstances mutex
+        std::lock_guard<std::mutex> lock(tmpinstances_mutex);
+        tmpinstances.push_back(std::shared_ptr<rpf::TrapezoidalMotionProfile>(p));
+    }
+    rpf::set_obj_ptr(env, obj, p);
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile__1destroy(
+        JNIEnv *env, jobject obj) {
+    auto ptr = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    rpf::set_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj, nullptr);
+    // Remove an entry from the instances list
+    rpf::remove_instance(tmpinstances, tmpinstances_mutex, ptr);
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile__1copy(
+        JNIEnv *env, jobject obj) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        auto ptr = std::make_shared<rpf::TrapezoidalMotionProfile>(*p);
+        {
+            // Acquire lock to tmpinstances mutex
+            std::lock_guard<std::mutex> lock(tmpinstances_mutex);
+            tmpinstances.push_back(ptr);
+        }
+        return reinterpret_cast<jlong>(ptr.get());
+    }
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_totalTime(
+        JNIEnv *env, jobject obj) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    else {
+        return p->total_time();
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_isReversed(
+        JNIEnv *env, jobject obj) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return false;
+    }
+    else {
+        return p->is_reversed();
+    }
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_position(
+        JNIEnv *env, jobject obj, jdouble t) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    try {
+        return p->position(t);
+    }
+    catch (const std::out_of_range &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_velocity(
+        JNIEnv *env, jobject obj, jdouble t) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    try {
+        return p->velocity(t);
+    }
+    catch (const std::out_of_range &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT jdouble JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_acceleration(
+        JNIEnv *env, jobject obj, jdouble t) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return 0;
+    }
+    try {
+        return p->acceleration(t);
+    }
+    catch (const std::out_of_range &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_update(JNIEnv *env,
+        jobject obj, jdouble current_time, jdouble current_pos, jdouble current_vel,
+        jdouble current_accel) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return false;
+    }
+    else {
+        return p->update(current_time, current_pos, current_vel, current_accel);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_arctos6135_robotpathfinder_motionprofile_TrapezoidalMotionProfile_sample(JNIEnv *env,
+        jobject obj, jdoubleArray times, jdoubleArray pos, jdoubleArray vel, jdoubleArray accel) {
+    auto p = rpf::get_obj_ptr<rpf::TrapezoidalMotionProfile>(env, obj);
+    if (!rpf::check_instance(tmpinstances, tmpinstances_mutex, p)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalStateException, "This object has already been freed");
+        return;
+    }
+
+    jsize len = env->GetArrayLength(times);
+    // The output arrays are optional, but must be able to hold all the samples
+    if ((pos && env->GetArrayLength(pos) < len) || (vel && env->GetArrayLength(vel) < len) ||
+            (accel && env->GetArrayLength(accel) < len)) {
+        rpf::throw_exception(
+                env, rpf::EX_IllegalArgumentException, "Output arrays are too short");
+        return;
+    }
+
+    // Copy the times in and the results out in bulk instead of one call per element
+    std::vector<double> t(len);
+    env->GetDoubleArrayRegion(times, 0, len, t.data());
+    std::vector<double> out_pos(pos ? len : 0), out_vel(vel ? len : 0),
+            out_accel(accel ? len : 0);
+    try {
+        p->sample(t.data(), len, pos ? out_pos.data() : nullptr, vel ? out_vel.data() : nullptr,
+                accel ? out_accel.data() : nullptr);
+    }
+    catch (const std::out_of_range &e) {
+        rpf::throw_exception(env, rpf::EX_IllegalArgumentException, e.what());
+        return;
+    }
+
+    if (pos) {
+        env->SetDoubleArrayRegion(pos, 0, len, out_pos.data());
+    }
+    if (vel) {
+        env->SetDoubleArrayRegion(vel, 0, len, out_vel.data());
+    }
+    if (accel) {
+        env->SetDoubleArrayRegion(accel, 0, len, out_accel.data());
+    }
+}
@@ -8,7 +8,21 @@
 std::list<std::shared_ptr<rpf::Path>> pinstances;
 std::list<std::shared_ptr<rpf::BasicTrajectory>> btinstances;
 std::list<std::shared_ptr<rpf::TankDriveTrajectory>> ttinstances;
+std::list<std::shared_ptr<rpf::TrapezoidalMotionProfile>> tmpinstances;
+std::list<std::shared_ptr<rpf::TankDriveFollower>> tdfinstances;
+std::list<std::shared_ptr<rpf::RealTimeRunner>> rtrinstances;
+std::list<std::shared_ptr<rpf::TelemetryRing>> telinstances;
+std::list<std::shared_ptr<rpf::GenerationJob>> gjinstances;
+std::list<std::shared_ptr<rpf::IncrementalGenerator>> iginstances;
+std::list<std::shared_ptr<rpf::SampledPath>> spinstances;
 
 std::mutex pinstances_mutex;
 std::mutex btinstances_mutex;
 std::mutex ttinstances_mutex;
+std::mutex tmpinstances_mutex;
+std::mutex tdfinstances_mutex;
+std::mutex rtrinstances_mutex;
+std::mutex telinstances_mutex;
+std::mutex gjinstances_mutex;
+std::mutex iginstances_mutex;
+std::mutex spinstances_mutex;
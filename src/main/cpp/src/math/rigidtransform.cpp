@@ -0,0 +1,18 @@
+#include "math/rigidtransform.h"
+#include "math/rpfmath.h"
+
+namespace rpf {
+
+    RigidTransform RigidTransform::between(const Waypoint &from, const Waypoint &to) {
+        RigidTransform rotation(Vec2D(0, 0), to.heading - from.heading);
+        return RigidTransform(Vec2D(to) - rotation.apply(Vec2D(from)), rotation.rotation);
+    }
+
+    RigidTransform RigidTransform::then(const RigidTransform &next) const {
+        return RigidTransform(next.apply(translation), rotation + next.rotation);
+    }
+
+    double RigidTransform::apply_angle(double angle) const {
+        return rotation == 0 ? angle : rpf::restrict_angle(angle + rotation);
+    }
+} // namespace rpf
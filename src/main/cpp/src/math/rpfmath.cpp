@@ -3,10 +3,6 @@
 #include <cmath>
 
 namespace rpf {
-    double lerp(double a, double b, double f) {
-        return (a * (1.0 - f)) + (b * f);
-    }
-
     double restrict_angle(double angle) {
         angle = std::fmod(angle, pi * 2);
         if(angle <= -pi) {
@@ -33,11 +29,27 @@ namespace rpf {
         return std::atan2(angle.y, angle.x);
     }
 
+    double angle_diff(double src, double target) {
+        double diff = target - src;
+        if (diff > pi) {
+            diff -= 2 * pi;
+        }
+        else if (diff <= -pi) {
+            diff += 2 * pi;
+        }
+        return diff;
+    }
+
     double restrict_abs(double x, double m) {
         return std::abs(x) <= m ? x : std::copysign(m, x);
     }
 
-    double curvature(double dx, double ddx, double dy, double ddy) {
-        return (dx * ddy - dy * ddx) / std::pow(dx * dx + dy * dy, 3.0 / 2.0);
+    double curvature_deriv(const Vec2D &d, const Vec2D &dd, const Vec2D &ddd) {
+        // k = c / m^(3/2), where c = x'y'' - y'x'' and m = x'^2 + y'^2
+        // dk/dt = (c' m - 3 c (x'x'' + y'y'')) / m^(5/2), and ds/dt = m^(1/2)
+        double m = d.x * d.x + d.y * d.y;
+        double c = d.x * dd.y - d.y * dd.x;
+        double dc = d.x * ddd.y - d.y * ddd.x;
+        return (dc * m - 3 * c * d.dot(dd)) / (m * m * m);
     }
 } // namespace rpf
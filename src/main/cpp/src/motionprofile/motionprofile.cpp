@@ -0,0 +1,21 @@
+#include "motionprofile/motionprofile.h"
+
+namespace rpf {
+
+    void MotionProfile::sample(const double *t, std::size_t count, double *pos, double *vel,
+            double *accel) const {
+        double p, v, a;
+        for (std::size_t i = 0; i < count; i++) {
+            sample(t[i], p, v, a);
+            if (pos) {
+                pos[i] = p;
+            }
+            if (vel) {
+                vel[i] = v;
+            }
+            if (accel) {
+                accel[i] = a;
+            }
+        }
+    }
+} // namespace rpf
@@ -0,0 +1,25 @@
+#include "motionprofile/tankdriverotationprofile.h"
+#include <algorithm>
+
+namespace rpf {
+
+    TankDriveRotationProfile::TankDriveRotationProfile(
+            const RobotSpecs &specs, double angle, double init_facing)
+            // The left wheel goes backwards to turn counterclockwise
+            : DualMotionProfile(TrapezoidalMotionProfile(specs, -angle * specs.base_width / 2),
+                      TrapezoidalMotionProfile(specs, angle * specs.base_width / 2)),
+              angle(angle), init_facing(init_facing) {
+    }
+
+    TankDriveMoment TankDriveRotationProfile::get(double t) const {
+        t = std::min(std::max(t, 0.0), total_time());
+        TankDriveMoment m;
+        sample(t, m.l_pos, m.r_pos, m.l_vel, m.r_vel, m.l_accel, m.r_accel);
+        // The angle turned by each wheel is its arc length divided by the base radius, and the
+        // left wheel moving forwards turns the robot clockwise
+        m.heading = restrict_angle((m.r_pos - m.l_pos) / get_specs().base_width + init_facing);
+        m.time = t;
+        m.init_facing = init_facing;
+        return m;
+    }
+} // namespace rpf
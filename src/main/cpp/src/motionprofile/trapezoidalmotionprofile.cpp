@@ -0,0 +1,176 @@
+#include "motionprofile/trapezoidalmotionprofile.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace rpf {
+
+    namespace {
+        // Same as the default float compare threshold of the Java MathUtils
+        constexpr double TIME_EPSILON = 1e-7;
+    } // namespace
+
+    TrapezoidalMotionProfile::TrapezoidalMotionProfile(
+            const RobotSpecs &specs, double dist, double init_vel)
+            : specs(specs) {
+        construct(dist, init_vel);
+    }
+
+    bool TrapezoidalMotionProfile::construct(double dist, double init_vel) {
+        // Like the Java implementation, this is never reset, so a profile that was reversed
+        // stays reversed when it is updated
+        if (dist < 0) {
+            reverse = true;
+            dist = -dist;
+            init_vel = -init_vel;
+        }
+        distance = dist;
+        max_acl = specs.max_a;
+        max_vel = std::max(specs.max_v, std::abs(init_vel));
+        this->init_vel = init_vel;
+
+        // Calculate the distance covered when accelerating and decelerating
+        // Formula is derived from the kinematic formula relating velocities, distance and
+        // acceleration, and the fact that d_accel + d_decel = dist
+        // Assumes there is no maximum cap on velocity
+        double d_accel = dist / 2 - init_vel * init_vel / (4 * max_acl);
+        double d_decel;
+        // If the acceleration distance is less than 0, the distance is not enough to decelerate
+        // back to 0
+        // Change the maximum acceleration so that we can
+        bool overshoot = false;
+        if (d_accel < 0) {
+            // Unless the distance left is 0, in which case there is nothing left to do
+            if (dist == 0) {
+                cruise_vel = accel_dist = cruise_dist = 0;
+                t_accel = t_cruise = t_total = 0;
+                return true;
+            }
+            // This value should make d_accel equal to 0
+            max_acl = init_vel * init_vel / (2 * dist);
+            d_decel = dist;
+            overshoot = true;
+        }
+        else {
+            d_decel = dist - d_accel;
+        }
+        // Calculate cruise velocity
+        double vc = std::sqrt(2 * max_acl * d_decel);
+        cruise_vel = std::min(vc, max_vel);
+
+        // Calculate acceleration time
+        t_accel = (cruise_vel - init_vel) / max_acl;
+        // Re-calculate the acceleration distance
+        // This is needed because the first result does not take into account the actual max
+        // velocity
+        accel_dist = t_accel * t_accel * max_acl * 0.5 + init_vel * t_accel;
+        // Calculate the deceleration time and distance
+        double t_decel = cruise_vel / max_acl;
+        double decel_dist = t_decel * t_decel * max_acl * 0.5;
+
+        // Calculate the cruise distance and time
+        cruise_dist = dist - accel_dist - decel_dist;
+        // A profile with no distance and no velocity has no cruise at all
+        t_cruise = cruise_vel > 0 ? cruise_dist / cruise_vel : 0;
+        // t_total is the total time in the range of this motion profile
+        // It does not include init_time
+        t_total = t_accel + t_cruise + t_decel;
+        return overshoot;
+    }
+
+    TrapezoidalMotionProfile::Phase TrapezoidalMotionProfile::phase_at(double &t) const {
+        if (t < init_time - TIME_EPSILON) {
+            throw std::out_of_range("Time out of range");
+        }
+        t -= init_time;
+        if (t < t_accel) {
+            return Phase::ACCEL;
+        }
+        else if (t < t_accel + t_cruise) {
+            return Phase::CRUISE;
+        }
+        else if (t <= t_total + TIME_EPSILON) {
+            return Phase::DECEL;
+        }
+        else {
+            throw std::out_of_range("Time out of range");
+        }
+    }
+
+    double TrapezoidalMotionProfile::position(double t) const {
+        double pos, vel, accel;
+        sample(t, pos, vel, accel);
+        return pos;
+    }
+
+    double TrapezoidalMotionProfile::velocity(double t) const {
+        double result;
+        switch (phase_at(t)) {
+        case Phase::ACCEL:
+            result = t * max_acl + init_vel;
+            break;
+        case Phase::CRUISE:
+            result = cruise_vel;
+            break;
+        default:
+            result = cruise_vel - (t - t_accel - t_cruise) * max_acl;
+            break;
+        }
+        return reverse ? -result : result;
+    }
+
+    double TrapezoidalMotionProfile::acceleration(double t) const {
+        double result;
+        switch (phase_at(t)) {
+        case Phase::ACCEL:
+            result = max_acl;
+            break;
+        case Phase::CRUISE:
+            result = 0;
+            break;
+        default:
+            result = -max_acl;
+            break;
+        }
+        return reverse ? -result : result;
+    }
+
+    void TrapezoidalMotionProfile::sample(
+            double t, double &pos, double &vel, double &accel) const {
+        switch (phase_at(t)) {
+        case Phase::ACCEL:
+            pos = t * t * max_acl * 0.5 + init_vel * t;
+            vel = t * max_acl + init_vel;
+            accel = max_acl;
+            break;
+        case Phase::CRUISE:
+            // The distance covered during acceleration plus the rest of the time multiplied by
+            // the cruise velocity
+            pos = accel_dist + (t - t_accel) * cruise_vel;
+            vel = cruise_vel;
+            accel = 0;
+            break;
+        default:
+            t -= t_accel + t_cruise;
+            pos = accel_dist + cruise_dist + t * cruise_vel - t * t * max_acl * 0.5;
+            vel = cruise_vel - t * max_acl;
+            accel = -max_acl;
+            break;
+        }
+        if (reverse) {
+            pos = -pos;
+            vel = -vel;
+            accel = -accel;
+        }
+        pos += init_dist;
+    }
+
+    bool TrapezoidalMotionProfile::update(
+            double current_time, double current_pos, double current_vel, double) {
+        init_time = current_time;
+        double prev_init_dist = init_dist;
+        init_dist = current_pos;
+        return construct((reverse ? -distance : distance) + prev_init_dist - current_pos,
+                current_vel);
+    }
+} // namespace rpf
@@ -1,6 +1,7 @@
 #include "path/path.h"
 #include "math/rpfmath.h"
 #include "paths.h"
+#include "util/instrumentation.h"
 #include <cmath>
 #include <stdexcept>
 
@@ -8,9 +9,11 @@ namespace rpf {
 
     Path::Path(const std::vector<Waypoint> &waypoints, double alpha, PathType type)
                 : waypoints(waypoints), alpha(alpha), type(type) {
+        RPF_PROBE_SCOPE(PATH_CONSTRUCT);
         if (waypoints.size() < 2) {
             throw std::invalid_argument("Not enough waypoints");
         }
+        auto &segments = *this->segments;
         segments.reserve(waypoints.size() - 1);
         switch (type) {
         case PathType::BEZIER:
@@ -44,37 +47,72 @@ namespace rpf {
                         Vec2D(0, 0), Vec2D(0, 0)));
             }
             break;
+        case PathType::QUINTIC_HERMITE_C2: {
+            std::vector<Vec2D> points;
+            std::vector<Vec2D> derivs;
+            points.reserve(waypoints.size());
+            derivs.reserve(waypoints.size());
+            for (const auto &waypoint : waypoints) {
+                points.push_back(static_cast<Vec2D>(waypoint));
+                derivs.push_back(Vec2D(
+                        std::cos(waypoint.heading) * alpha, std::sin(waypoint.heading) * alpha));
+            }
+            // Instead of zero, the second derivatives are solved for so that the curvature
+            // changes smoothly through the waypoints
+            auto second_derivs = QuinticSegment::min_jerk_second_derivs(points, derivs);
+            for (size_t i = 0; i < waypoints.size() - 1; i++) {
+                segments.push_back(std::make_unique<QuinticSegment>(points[i], points[i + 1],
+                        derivs[i], derivs[i + 1], second_derivs[i], second_derivs[i + 1]));
+            }
+            break;
+        }
+        case PathType::CLOTHOID:
+            // Clothoids are fitted to the headings directly, so alpha is not used
+            for (size_t i = 0; i < waypoints.size() - 1; i++) {
+                segments.push_back(std::make_unique<ClothoidSegment>(
+                        static_cast<Vec2D>(waypoints[i]), static_cast<Vec2D>(waypoints[i + 1]),
+                        waypoints[i].heading, waypoints[i + 1].heading));
+            }
+            break;
+        }
+
+        curvature_bounds->reserve(segments.size());
+        for (const auto &segment : segments) {
+            curvature_bounds->push_back(segment->max_curvature());
         }
     }
 
-    Vec2D Path::at(double t) const {
+    const SplineSegment &Path::segment_at(double t, double &seg_t) const {
+        const auto &segments = *this->segments;
         if (t >= 1) {
-            return segments[segments.size() - 1]->at(1);
+            seg_t = 1;
+            return *segments[segments.size() - 1];
         }
 
         t *= segments.size();
-        return segments[(size_t) std::floor(t)]->at(std::fmod(t, 1.0));
+        seg_t = std::fmod(t, 1.0);
+        return *segments[(size_t) std::floor(t)];
     }
-    Vec2D Path::deriv_at(double t) const {
-        if (t >= 1) {
-            return segments[segments.size() - 1]->deriv_at(1);
-        }
 
-        t *= segments.size();
-        return segments[(size_t) std::floor(t)]->deriv_at(std::fmod(t, 1.0));
+    Vec2D Path::at(double t) const {
+        double seg_t;
+        Vec2D v = segment_at(t, seg_t).at(seg_t);
+        return transform.is_identity() ? v : transform.apply(v);
+    }
+    Vec2D Path::deriv_at(double t) const {
+        double seg_t;
+        Vec2D v = segment_at(t, seg_t).deriv_at(seg_t);
+        return transform.is_identity() ? v : transform.rotate(v);
     }
     Vec2D Path::second_deriv_at(double t) const {
-        if (t >= 1) {
-            return segments[segments.size() - 1]->second_deriv_at(1);
-        }
-
-        t *= segments.size();
-        return segments[(size_t) std::floor(t)]->second_deriv_at(std::fmod(t, 1.0));
+        double seg_t;
+        Vec2D v = segment_at(t, seg_t).second_deriv_at(seg_t);
+        return transform.is_identity() ? v : transform.rotate(v);
     }
     std::pair<Vec2D, Vec2D> Path::wheels_at(double t) const {
-
-        Vec2D pos = at(t);
-        Vec2D deriv = deriv_at(t);
+        return wheels_at(at(t), deriv_at(t));
+    }
+    std::pair<Vec2D, Vec2D> Path::wheels_at(const Vec2D &pos, const Vec2D &deriv) const {
         double heading = std::atan2(deriv.y, deriv.x);
         double s = std::sin(heading);
         double c = std::cos(heading);
@@ -87,24 +125,108 @@ namespace rpf {
         return wheels;
     }
 
+    // Curvature does not depend on how the path is parameterized, so the derivatives of the segment
+    // can be used directly without scaling them by the number of segments
+    double Path::curvature_at(double t) const {
+        double seg_t;
+        const auto &segment = segment_at(t, seg_t);
+        Vec2D d = segment.deriv_at(seg_t);
+        Vec2D dd = segment.second_deriv_at(seg_t);
+        return rpf::curvature(d.x, dd.x, d.y, dd.y);
+    }
+    double Path::curvature_deriv_at(double t) const {
+        double seg_t;
+        const auto &segment = segment_at(t, seg_t);
+        return rpf::curvature_deriv(segment.deriv_at(seg_t), segment.second_deriv_at(seg_t),
+                segment.third_deriv_at(seg_t));
+    }
+    // The batched versions find the segment type once, and then evaluate the segments directly
+    void Path::curvature_at(const std::vector<double> &t, std::vector<double> &out) const {
+        out.resize(t.size());
+        visit([&](auto tag) {
+            PathEvaluator<typename decltype(tag)::type> eval(*this);
+            for (size_t i = 0; i < t.size(); i++) {
+                double seg_t;
+                const auto &segment = eval.segment_at(t[i], seg_t);
+                Vec2D d = segment.deriv_at(seg_t);
+                Vec2D dd = segment.second_deriv_at(seg_t);
+                out[i] = rpf::curvature(d.x, dd.x, d.y, dd.y);
+            }
+        });
+    }
+    void Path::curvature_deriv_at(const std::vector<double> &t, std::vector<double> &out) const {
+        out.resize(t.size());
+        visit([&](auto tag) {
+            PathEvaluator<typename decltype(tag)::type> eval(*this);
+            for (size_t i = 0; i < t.size(); i++) {
+                double seg_t;
+                const auto &segment = eval.segment_at(t[i], seg_t);
+                out[i] = rpf::curvature_deriv(segment.deriv_at(seg_t),
+                        segment.second_deriv_at(seg_t), segment.third_deriv_at(seg_t));
+            }
+        });
+    }
+    void Path::wheels_at(
+            const std::vector<double> &t, std::vector<std::pair<Vec2D, Vec2D>> &out) const {
+        out.resize(t.size());
+        visit([&](auto tag) {
+            PathEvaluator<typename decltype(tag)::type> eval(*this);
+            for (size_t i = 0; i < t.size(); i++) {
+                out[i] = eval.wheels_at(t[i]);
+            }
+        });
+        // The evaluator works on the segments, which are not transformed
+        if (!transform.is_identity()) {
+            for (auto &wheels : out) {
+                wheels.first = transform.apply(wheels.first);
+                wheels.second = transform.apply(wheels.second);
+            }
+        }
+    }
+    double Path::curvature_bound_at(double t) const {
+        const auto &curvature_bounds = *this->curvature_bounds;
+        if (t >= 1) {
+            return curvature_bounds[curvature_bounds.size() - 1];
+        }
+        return curvature_bounds[(size_t) std::floor(t * curvature_bounds.size())];
+    }
+
     double Path::compute_len(int points) {
+        return compute_len(points, 0, points);
+    }
+
+    double Path::compute_len(int points, int begin, int end) {
+        RPF_PROBE_SCOPE(PATH_COMPUTE_LEN);
+        auto &s2t_table = *this->s2t_table;
         double dt = 1.0 / (points - 1);
 
-        Vec2D last = at(0);
-        total_len = 0;
-        s2t_table.push_back(std::pair<double, double>(0, 0));
+        visit([&](auto tag) {
+            PathEvaluator<typename decltype(tag)::type> eval(*this);
+            if (begin == 0) {
+                total_len = 0;
+                s2t_table.reserve(s2t_table.size() + points);
+                s2t_table.push_back(std::pair<double, double>(0, 0));
+                begin = 1;
+            }
+            if (begin >= end) {
+                return;
+            }
+            // Start from where the last call left off
+            Vec2D last = eval.at((begin - 1) * dt);
 
-        for (int i = 1; i < points; i++) {
-            Vec2D current = at(i * dt);
-            total_len += last.dist(current);
+            for (int i = begin; i < end; i++) {
+                Vec2D current = eval.at(i * dt);
+                total_len += last.dist(current);
 
-            s2t_table.push_back(std::pair<double, double>(total_len, i * dt));
-            last = current;
-        }
+                s2t_table.push_back(std::pair<double, double>(total_len, i * dt));
+                last = current;
+            }
+        });
         return total_len;
     }
 
     double Path::s2t(double s) const {
+        const auto &s2t_table = *this->s2t_table;
         if (s2t_table.size() == 0) {
             throw std::runtime_error("Lookup table not generated");
         }
@@ -145,7 +267,38 @@ namespace rpf {
             }
         }
     }
+    double Path::s2t(double s, std::size_t &cursor) const {
+        const auto &s2t_table = *this->s2t_table;
+        if (s2t_table.size() == 0) {
+            throw std::runtime_error("Lookup table not generated");
+        }
+
+        double dist = s * total_len;
+        size_t end = s2t_table.size() - 1;
+        // Same as the binary search
+        if (dist > s2t_table[end - 1].first) {
+            return 1;
+        }
+        if (dist < 0) {
+            return 0;
+        }
+        if (cursor >= end || s2t_table[cursor].first > dist) {
+            cursor = 0;
+        }
+        while (s2t_table[cursor + 1].first < dist) {
+            cursor++;
+        }
+
+        double cur_dist = s2t_table[cursor].first;
+        if (cur_dist == dist) {
+            return s2t_table[cursor].second;
+        }
+        double next = s2t_table[cursor + 1].first;
+        double f = (dist - cur_dist) / (next - cur_dist);
+        return rpf::lerp(s2t_table[cursor].second, s2t_table[cursor + 1].second, f);
+    }
     double Path::t2s(double t) const {
+        const auto &s2t_table = *this->s2t_table;
         if (s2t_table.size() == 0) {
             throw std::runtime_error("Lookup table not generated");
         }
@@ -186,13 +339,20 @@ namespace rpf {
         }
     }
 
+    Vec2D Path::reflect(const Vec2D &v, const Vec2D &ref) const {
+        if (transform.is_identity()) {
+            return v.reflect(ref);
+        }
+        return (v - transform.translation).reflect(ref) + transform.translation;
+    }
+
     std::shared_ptr<Path> Path::mirror_lr() const {
         Vec2D ref(std::cos(waypoints[0].heading), std::sin(waypoints[0].heading));
         std::vector<Waypoint> w;
         w.reserve(waypoints.size());
 
         for (auto wp : waypoints) {
-            w.push_back(Waypoint(static_cast<Vec2D>(wp).reflect(ref),
+            w.push_back(Waypoint(reflect(static_cast<Vec2D>(wp), ref),
                     rpf::mirror_angle(wp.heading, waypoints[0].heading)));
         }
         auto p = std::make_shared<Path>(w, alpha, type);
@@ -205,7 +365,7 @@ namespace rpf {
         w.reserve(waypoints.size());
 
         for (auto wp : waypoints) {
-            w.push_back(Waypoint(static_cast<Vec2D>(wp).reflect(ref),
+            w.push_back(Waypoint(reflect(static_cast<Vec2D>(wp), ref),
                     rpf::mirror_angle(wp.heading, waypoints[0].heading + rpf::pi / 2)));
         }
         auto p = std::make_shared<Path>(w, alpha, type);
@@ -226,4 +386,16 @@ namespace rpf {
         p->set_backwards(!backwards);
         return p;
     }
+    std::shared_ptr<Path> Path::transformed(const RigidTransform &transform) const {
+        // The copy shares the segments and the lookup table
+        auto p = std::make_shared<Path>(*this);
+        p->transform = this->transform.then(transform);
+        for (auto &wp : p->waypoints) {
+            Vec2D pos = transform.apply(static_cast<Vec2D>(wp));
+            wp.x = pos.x;
+            wp.y = pos.y;
+            wp.heading = transform.apply_angle(wp.heading);
+        }
+        return p;
+    }
 } // namespace rpf
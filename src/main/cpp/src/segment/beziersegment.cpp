@@ -1,34 +1,33 @@
 #include "segment/beziersegment.h"
 
 namespace rpf {
+    namespace {
+        // The coefficients of the 4 cubic Bernstein polynomials in the power basis
+        // basis[i][j] is the coefficient of t^j in the i-th basis function
+        constexpr double basis[4][4] = {
+                {1, -3, 3, -1}, // (1 - t)^3
+                {0, 3, -6, 3},  // 3t(1 - t)^2
+                {0, 0, 3, -3},  // 3t^2(1 - t)
+                {0, 0, 0, 1},   // t^3
+        };
+    } // namespace
+
+    BezierSegment::BezierSegment(const Vec2D &a, const Vec2D &b, const Vec2D &c, const Vec2D &d) {
+        ctrl_pts[0] = a;
+        ctrl_pts[1] = b;
+        ctrl_pts[2] = c;
+        ctrl_pts[3] = d;
+
+        // Expand the Bernstein polynomials into the power basis
+        for (int i = 0; i <= DEGREE; i++) {
+            coeffs[i] = a * basis[0][i] + b * basis[1][i] + c * basis[2][i] + d * basis[3][i];
+        }
+    }
+
     BezierSegment BezierSegment::from_hermite(
             const Vec2D &at0, const Vec2D &at1, const Vec2D &deriv_at0, const Vec2D &deriv_at1) {
         Vec2D p1 = at0 + deriv_at0 * (1.0 / 3.0);
         Vec2D p2 = at1 + deriv_at1 * (-1.0 / 3.0);
         return BezierSegment(at0, p1, p2, at1);
     }
-
-    Vec2D BezierSegment::at(double t) const {
-        double u = 1 - t;
-        double uu = u * u;
-        double uuu = u * u * u;
-        double tt = t * t;
-        double ttt = t * t * t;
-        return ctrl_pts[0] * uuu + ctrl_pts[1] * 3 * uu * t + ctrl_pts[2] * 3 * u * tt +
-               ctrl_pts[3] * ttt;
-    }
-
-    Vec2D BezierSegment::deriv_at(double t) const {
-        double u = 1 - t;
-        double uu = u * u;
-        double tt = t * t;
-        return (ctrl_pts[1] - ctrl_pts[0]) * 3 * uu + (ctrl_pts[2] - ctrl_pts[1]) * 6 * u * t +
-               (ctrl_pts[3] - ctrl_pts[2]) * 3 * tt;
-    }
-
-    Vec2D BezierSegment::second_deriv_at(double t) const {
-        double u = 1 - t;
-        return (ctrl_pts[2] - 2 * ctrl_pts[1] + ctrl_pts[0]) * 6 * u +
-               (ctrl_pts[3] - 2 * ctrl_pts[2] + ctrl_pts[1]) * 6 * t;
-    }
 } // namespace rpf
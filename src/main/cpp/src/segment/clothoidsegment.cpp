@@ -0,0 +1,131 @@
+#include "segment/clothoidsegment.h"
+#include "math/rpfmath.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace rpf {
+
+    /*
+     * Fitting a clothoid to two points and two headings follows the method in
+     * Bertolazzi and Frego, "G1 fitting with clothoids" (2015).
+     *
+     * In a frame where the chord from p0 to p1 is the x axis, the heading along the segment is
+     * phi0 + (delta - A) t + A t^2, where phi0 and phi1 are the headings at both ends relative to
+     * the chord, and delta = phi1 - phi0. The only unknown is A, which is found with Newton's
+     * method by making the end of the segment lie on the chord, i.e. the integral of the sine of
+     * the heading is zero. The length is then the length of the chord divided by the integral of
+     * the cosine of the heading.
+     *
+     * The Fresnel-type integrals are evaluated with Gauss-Legendre quadrature, since the heading is
+     * a smooth quadratic in t.
+     */
+
+    namespace {
+        // 5-point Gauss-Legendre quadrature nodes and weights on [-1, 1]
+        constexpr double GAUSS_NODES[5] = {-0.9061798459386640, -0.5384693101056831, 0.0,
+                0.5384693101056831, 0.9061798459386640};
+        constexpr double GAUSS_WEIGHTS[5] = {0.2369268850561891, 0.4786286704993665,
+                0.5688888888888889, 0.4786286704993665, 0.2369268850561891};
+        // Number of intervals used for the integrals when fitting
+        constexpr int FIT_INTERVALS = 16;
+
+        // Computes the integrals of the cosine and sine of the heading over [0, 1], and the
+        // derivative of the sine integral with respect to A
+        void fit_integrals(double phi0, double delta, double a, double &x, double &y, double &dy) {
+            x = y = dy = 0;
+            double half = 0.5 / FIT_INTERVALS;
+            for (int i = 0; i < FIT_INTERVALS; i++) {
+                double mid = (2 * i + 1) * half;
+                for (int j = 0; j < 5; j++) {
+                    double t = mid + half * GAUSS_NODES[j];
+                    double theta = phi0 + (delta - a + a * t) * t;
+                    double w = half * GAUSS_WEIGHTS[j];
+                    double c = std::cos(theta);
+                    x += w * c;
+                    y += w * std::sin(theta);
+                    dy += w * (t * t - t) * c;
+                }
+            }
+        }
+    } // namespace
+
+    ClothoidSegment::ClothoidSegment(
+            const Vec2D &p0, const Vec2D &p1, double heading0, double heading1) {
+        Vec2D chord = p1 - p0;
+        double r = chord.magnitude();
+        if (r == 0) {
+            throw std::invalid_argument("Clothoid segment endpoints cannot be the same");
+        }
+        double phi = std::atan2(chord.y, chord.x);
+        double phi0 = rpf::restrict_angle(heading0 - phi);
+        double phi1 = rpf::restrict_angle(heading1 - phi);
+        double delta = phi1 - phi0;
+
+        // The initial guess from the paper
+        double a = 3 * (phi0 + phi1);
+        double x, y, dy;
+        for (int i = 0; i < 50; i++) {
+            fit_integrals(phi0, delta, a, x, y, dy);
+            if (std::abs(y) < 1e-12 || dy == 0) {
+                break;
+            }
+            a -= y / dy;
+        }
+        fit_integrals(phi0, delta, a, x, y, dy);
+        if (!(std::abs(y) < 1e-9) || !(x > 0)) {
+            throw std::invalid_argument("Clothoid segment cannot be fitted to the waypoints");
+        }
+
+        len = r / x;
+        theta0 = phi + phi0;
+        dtheta = delta - a;
+        ddtheta = a;
+
+        table[0] = p0;
+        for (int i = 0; i < TABLE_SIZE; i++) {
+            table[i + 1] = table[i] +
+                           integrate(static_cast<double>(i) / TABLE_SIZE,
+                                   static_cast<double>(i + 1) / TABLE_SIZE) *
+                                   len;
+        }
+    }
+
+    Vec2D ClothoidSegment::integrate(double t0, double t1) const {
+        double half = (t1 - t0) / 2;
+        double mid = (t0 + t1) / 2;
+        Vec2D result;
+        for (int j = 0; j < 5; j++) {
+            double theta = heading_at(mid + half * GAUSS_NODES[j]);
+            result += Vec2D(std::cos(theta), std::sin(theta)) * (half * GAUSS_WEIGHTS[j]);
+        }
+        return result;
+    }
+
+    Vec2D ClothoidSegment::at(double t) const {
+        int i = std::min(std::max(static_cast<int>(t * TABLE_SIZE), 0), TABLE_SIZE - 1);
+        return table[i] + integrate(static_cast<double>(i) / TABLE_SIZE, t) * len;
+    }
+    Vec2D ClothoidSegment::deriv_at(double t) const {
+        double theta = heading_at(t);
+        return Vec2D(std::cos(theta), std::sin(theta)) * len;
+    }
+    Vec2D ClothoidSegment::second_deriv_at(double t) const {
+        // The derivative of the heading with respect to t, times the derivative rotated by 90
+        // degrees
+        double theta = heading_at(t);
+        return Vec2D(-std::sin(theta), std::cos(theta)) * (len * (dtheta + 2 * ddtheta * t));
+    }
+    Vec2D ClothoidSegment::third_deriv_at(double t) const {
+        double theta = heading_at(t);
+        double dtheta_dt = dtheta + 2 * ddtheta * t;
+        Vec2D tangent(std::cos(theta), std::sin(theta));
+        Vec2D normal(-tangent.y, tangent.x);
+        return (normal * (2 * ddtheta) - tangent * (dtheta_dt * dtheta_dt)) * len;
+    }
+
+    double ClothoidSegment::max_curvature() const {
+        // The curvature is linear, so the max is at one of the ends
+        return std::max(std::abs(dtheta), std::abs(dtheta + 2 * ddtheta)) / len;
+    }
+} // namespace rpf
@@ -0,0 +1,110 @@
+#include "segment/polynomialsegment.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace rpf {
+
+    namespace {
+        // The max degree of the polynomials used to bound the curvature
+        // The speed squared of a quintic is of degree 8
+        constexpr int BOUND_DEGREE = 8;
+        // Number of intervals the segment is split into when bounding the curvature
+        // More intervals give a tighter bound
+        constexpr int BOUND_INTERVALS = 8;
+
+        // Multiplies the polynomials a and b, and adds the result times s to out
+        void mul_add(const double *a, int na, const double *b, int nb, double s, double *out) {
+            for (int i = 0; i <= na; i++) {
+                for (int j = 0; j <= nb; j++) {
+                    out[i + j] += s * a[i] * b[j];
+                }
+            }
+        }
+
+        // Finds the Bernstein coefficients of p(t0 + (t1 - t0) u) for u in [0, 1]
+        // By the convex hull property, p on [t0, t1] is bounded by the min and max of these
+        void to_bernstein(const double *p, int n, double t0, double t1, double *out) {
+            // Compose with t0 + h u using Horner's method
+            double h = t1 - t0;
+            double q[BOUND_DEGREE + 1] = {};
+            for (int i = n; i >= 0; i--) {
+                // q = q * (t0 + h u) + p[i]
+                for (int j = n; j > 0; j--) {
+                    q[j] = q[j] * t0 + q[j - 1] * h;
+                }
+                q[0] = q[0] * t0 + p[i];
+            }
+            // Convert from the power basis to the Bernstein basis
+            // b_i = sum over j <= i of C(i, j) / C(n, j) q_j
+            for (int i = 0; i <= n; i++) {
+                out[i] = 0;
+                double cij = 1;
+                double cnj = 1;
+                for (int j = 0; j <= i; j++) {
+                    out[i] += cij / cnj * q[j];
+                    cij = cij * (i - j) / (j + 1);
+                    cnj = cnj * (n - j) / (j + 1);
+                }
+            }
+        }
+    } // namespace
+
+    /*
+     * The curvature is (x'y'' - y'x'') / (x'^2 + y'^2)^(3/2). Both the numerator and the speed
+     * squared in the denominator are polynomials, so on each interval the numerator can be bounded
+     * from above and the speed squared from below using their Bernstein coefficients. This gives
+     * a bound that is always at least the true max curvature, without having to find any roots.
+     */
+    template <int Degree>
+    double PolynomialSegment<Degree>::max_curvature() const {
+        if (Degree < 2) {
+            return 0;
+        }
+        constexpr int degree = Degree;
+        // Coefficients of the first and second derivatives
+        double dx[Degree + 1] = {}, dy[Degree + 1] = {};
+        double ddx[Degree + 1] = {}, ddy[Degree + 1] = {};
+        for (int i = 1; i <= degree; i++) {
+            dx[i - 1] = coeffs[i].x * i;
+            dy[i - 1] = coeffs[i].y * i;
+        }
+        for (int i = 1; i < degree; i++) {
+            ddx[i - 1] = dx[i] * i;
+            ddy[i - 1] = dy[i] * i;
+        }
+        // The numerator x'y'' - y'x'' and the speed squared x'^2 + y'^2
+        double cross[BOUND_DEGREE + 1] = {};
+        double speed2[BOUND_DEGREE + 1] = {};
+        mul_add(dx, degree - 1, ddy, degree - 2, 1, cross);
+        mul_add(dy, degree - 1, ddx, degree - 2, -1, cross);
+        mul_add(dx, degree - 1, dx, degree - 1, 1, speed2);
+        mul_add(dy, degree - 1, dy, degree - 1, 1, speed2);
+        int cross_degree = 2 * degree - 3;
+        int speed2_degree = 2 * degree - 2;
+
+        double bound = 0;
+        for (int i = 0; i < BOUND_INTERVALS; i++) {
+            double t0 = static_cast<double>(i) / BOUND_INTERVALS;
+            double t1 = static_cast<double>(i + 1) / BOUND_INTERVALS;
+
+            double b[BOUND_DEGREE + 1];
+            to_bernstein(speed2, speed2_degree, t0, t1, b);
+            double min_speed2 = *std::min_element(b, b + speed2_degree + 1);
+            if (min_speed2 <= 0) {
+                // The speed may reach zero, in which case the curvature is unbounded
+                return std::numeric_limits<double>::infinity();
+            }
+            to_bernstein(cross, cross_degree, t0, t1, b);
+            double max_cross = 0;
+            for (int j = 0; j <= cross_degree; j++) {
+                max_cross = std::max(max_cross, std::abs(b[j]));
+            }
+            bound = std::max(bound, max_cross / (min_speed2 * std::sqrt(min_speed2)));
+        }
+        return bound;
+    }
+
+    template class PolynomialSegment<3>;
+    template class PolynomialSegment<5>;
+} // namespace rpf
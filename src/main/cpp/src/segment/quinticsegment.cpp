@@ -1,79 +1,75 @@
 #include "segment/quinticsegment.h"
-#include <cmath>
+#include <stdexcept>
 
 namespace rpf {
-    // The 6 quintic hermite basis functions
-    // They can be found here: https://www.rose-hulman.edu/~finn/CCLI/Notes/day09.pdf
-    double QuinticSegment::basis0(double t) {
-        return 1 - 10 * t * t * t + 15 * std::pow(t, 4) - 6 * std::pow(t, 5);
-    }
-    double QuinticSegment::basis1(double t) {
-        return t - 6 * t * t * t + 8 * std::pow(t, 4) - 3 * std::pow(t, 5);
-    }
-    double QuinticSegment::basis2(double t) {
-        return t * t / 2 - 3 * t * t * t / 2 + 3 * std::pow(t, 4) / 2 - std::pow(t, 5) / 2;
-    }
-    double QuinticSegment::basis3(double t) {
-        return t * t * t / 2 - std::pow(t, 4) + std::pow(t, 5) / 2;
-    }
-    double QuinticSegment::basis4(double t) {
-        return -4 * t * t * t + 7 * std::pow(t, 4) - 3 * std::pow(t, 5);
-    }
-    double QuinticSegment::basis5(double t) {
-        return 10 * t * t * t - 15 * std::pow(t, 4) + 6 * std::pow(t, 5);
-    }
+    namespace {
+        // The coefficients of the 6 quintic hermite basis functions in the power basis
+        // They can be found here: https://www.rose-hulman.edu/~finn/CCLI/Notes/day09.pdf
+        // basis[i][j] is the coefficient of t^j in the i-th basis function
+        constexpr double basis[6][6] = {
+                {1, 0, 0, -10, 15, -6},       // p0
+                {0, 1, 0, -6, 8, -3},         // v0
+                {0, 0, 0.5, -1.5, 1.5, -0.5}, // a0
+                {0, 0, 0, 0.5, -1, 0.5},      // a1
+                {0, 0, 0, -4, 7, -3},         // v1
+                {0, 0, 0, 10, -15, 6},        // p1
+        };
+    } // namespace
 
-    // The derivatives of the basis functions
-    double QuinticSegment::basis_deriv0(double t) {
-        return -30 * t * t + 60 * t * t * t - 30 * std::pow(t, 4);
-    }
-    double QuinticSegment::basis_deriv1(double t) {
-        return 1 - 18 * t * t + 32 * t * t * t - 15 * std::pow(t, 4);
-    }
-    double QuinticSegment::basis_deriv2(double t) {
-        return t - 9 * t * t / 2 + 6 * t * t * t - 5 * std::pow(t, 4) / 2;
-    }
-    double QuinticSegment::basis_deriv3(double t) {
-        return 3 * t * t / 2 - 4 * t * t * t + 5 * std::pow(t, 4) / 2;
-    }
-    double QuinticSegment::basis_deriv4(double t) {
-        return -12 * t * t + 28 * t * t * t - 15 * std::pow(t, 4);
-    }
-    double QuinticSegment::basis_deriv5(double t) {
-        return 30 * t * t - 60 * t * t * t + 30 * std::pow(t, 4);
+    QuinticSegment::QuinticSegment(const Vec2D &p0, const Vec2D &p1, const Vec2D &v0,
+            const Vec2D &v1, const Vec2D &a0, const Vec2D &a1)
+            : p0(p0), p1(p1), v0(v0), v1(v1), a0(a0), a1(a1) {
+        for (int i = 0; i <= DEGREE; i++) {
+            coeffs[i] = p0 * basis[0][i] + v0 * basis[1][i] + a0 * basis[2][i] +
+                        a1 * basis[3][i] + v1 * basis[4][i] + p1 * basis[5][i];
+        }
     }
 
-    // The second derivatives of the basis functions
-    double QuinticSegment::basis_second_deriv0(double t) {
-        return -60 * t + 180 * t * t - 120 * t * t * t;
-    }
-    double QuinticSegment::basis_second_deriv1(double t) {
-        return -36 * t + 96 * t * t - 60 * t * t * t;
-    }
-    double QuinticSegment::basis_second_deriv2(double t) {
-        return 1 - 9 * t + 18 * t * t - 10 * t * t * t;
-    }
-    double QuinticSegment::basis_second_deriv3(double t) {
-        return 3 * t - 12 * t * t + 10 * t * t * t;
-    }
-    double QuinticSegment::basis_second_deriv4(double t) {
-        return -24 * t + 84 * t * t - 60 * t * t * t;
-    }
-    double QuinticSegment::basis_second_deriv5(double t) {
-        return 60 * t - 180 * t * t + 120 * t * t * t;
-    }
+    /*
+     * Each second derivative is shared by the two segments next to it, so the path is always C2.
+     * Setting the gradient of the total jerk energy to zero gives one equation per point, and since
+     * every point only affects two segments the system is tridiagonal:
+     *
+     * 3 a0 - a1 = 20 (p1 - p0) - 12 v0 - 8 v1
+     * -a(i-1) + 6 ai - a(i+1) = 20 (p(i+1) - 2 pi + p(i-1)) + 8 (v(i-1) - v(i+1))
+     * -a(n-1) + 3 an = 20 (p(n-1) - pn) + 8 v(n-1) + 12 vn
+     *
+     * The matrix is strictly diagonally dominant, so it can be solved without pivoting in O(n)
+     * with the Thomas algorithm.
+     */
+    std::vector<Vec2D> QuinticSegment::min_jerk_second_derivs(
+            const std::vector<Vec2D> &points, const std::vector<Vec2D> &derivs) {
+        if (points.size() < 2 || points.size() != derivs.size()) {
+            throw std::invalid_argument("Invalid points or derivatives");
+        }
+        size_t n = points.size();
 
-    Vec2D QuinticSegment::at(double t) const {
-        return p0 * basis0(t) + v0 * basis1(t) + a0 * basis2(t) + a1 * basis3(t) + v1 * basis4(t) +
-               p1 * basis5(t);
-    }
-    Vec2D QuinticSegment::deriv_at(double t) const {
-        return p0 * basis_deriv0(t) + v0 * basis_deriv1(t) + a0 * basis_deriv2(t) +
-               a1 * basis_deriv3(t) + v1 * basis_deriv4(t) + p1 * basis_deriv5(t);
-    }
-    Vec2D QuinticSegment::second_deriv_at(double t) const {
-        return p0 * basis_second_deriv0(t) + v0 * basis_second_deriv1(t) +
-               a0 * basis_second_deriv2(t) + a1 * basis_second_deriv3(t) +
-               v1 * basis_second_deriv4(t) + p1 * basis_second_deriv5(t);
+        // Lower, main and upper diagonals, and the right hand side
+        std::vector<double> lower(n, -1);
+        std::vector<double> diag(n, 6);
+        std::vector<double> upper(n, -1);
+        std::vector<Vec2D> rhs(n);
+        diag[0] = 3;
+        diag[n - 1] = 3;
+        rhs[0] = (points[1] - points[0]) * 20 - derivs[0] * 12 - derivs[1] * 8;
+        for (size_t i = 1; i < n - 1; i++) {
+            rhs[i] = (points[i + 1] - points[i] * 2 + points[i - 1]) * 20 +
+                     (derivs[i - 1] - derivs[i + 1]) * 8;
+        }
+        rhs[n - 1] = (points[n - 2] - points[n - 1]) * 20 + derivs[n - 2] * 8 + derivs[n - 1] * 12;
+
+        // Forward elimination
+        for (size_t i = 1; i < n; i++) {
+            double m = lower[i] / diag[i - 1];
+            diag[i] -= m * upper[i - 1];
+            rhs[i] -= rhs[i - 1] * m;
+        }
+        // Back substitution
+        std::vector<Vec2D> result(n);
+        result[n - 1] = rhs[n - 1] / diag[n - 1];
+        for (size_t i = n - 1; i-- > 0;) {
+            result[i] = (rhs[i] - result[i + 1] * upper[i]) / diag[i];
+        }
+        return result;
     }
 } // namespace rpf
@@ -0,0 +1,124 @@
+#include "trajectory/asyncgeneration.h"
+#include <chrono>
+
+namespace rpf {
+
+    GenerationJob::Status GenerationJob::get_status() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return status;
+    }
+
+    bool GenerationJob::is_finished() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return status != Status::PENDING && status != Status::RUNNING;
+    }
+
+    bool GenerationJob::cancel() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (status == Status::RUNNING) {
+                // Too late, run() has already decided how the job ends
+                if (finishing) {
+                    return false;
+                }
+                // Let the generation stop itself; run() finishes the job as cancelled
+                token.cancel();
+                return true;
+            }
+            if (status != Status::PENDING || finishing) {
+                return false;
+            }
+            // Make run() skip the job
+            // The status stays PENDING until finish() has published the result
+            finishing = true;
+        }
+        finish(Status::CANCELLED, std::make_exception_ptr(GenerationCancelled()), "");
+        return true;
+    }
+
+    void GenerationJob::wait() const {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return status != Status::PENDING && status != Status::RUNNING; });
+    }
+
+    bool GenerationJob::wait_for(double timeout) const {
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_for(lock, std::chrono::duration<double>(timeout),
+                [this] { return status != Status::PENDING && status != Status::RUNNING; });
+    }
+
+    std::string GenerationJob::get_error() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return error;
+    }
+
+    void GenerationJob::on_complete(std::function<void()> callback) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (status == Status::PENDING || status == Status::RUNNING) {
+                callbacks.push_back(std::move(callback));
+                return;
+            }
+        }
+        callback();
+    }
+
+    void GenerationJob::run() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Cancelled while waiting in the queue
+            if (status != Status::PENDING || finishing) {
+                return;
+            }
+            status = Status::RUNNING;
+        }
+
+        std::exception_ptr ex;
+        std::string message;
+        bool cancelled = false;
+        try {
+            generate();
+        }
+        catch (const GenerationCancelled &) {
+            ex = std::current_exception();
+            cancelled = true;
+        }
+        catch (const std::exception &e) {
+            ex = std::current_exception();
+            message = e.what();
+        }
+        catch (...) {
+            ex = std::current_exception();
+            message = "Unknown error";
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Cancelled after the last check, when it was too late to stop
+            // This is checked under the lock, so that once cancel() returns true the job is always
+            // cancelled, and once this is done cancel() returns false
+            if (!cancelled && token.is_cancelled()) {
+                ex = std::make_exception_ptr(GenerationCancelled());
+                message.clear();
+                cancelled = true;
+            }
+            finishing = true;
+        }
+        finish(cancelled ? Status::CANCELLED : ex ? Status::FAILED : Status::DONE, ex, message);
+    }
+
+    void GenerationJob::finish(Status status, std::exception_ptr ex, const std::string &error) {
+        // Publish first, so that the future is ready by the time wait() returns
+        publish(ex);
+        std::vector<std::function<void()>> to_call;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            this->status = status;
+            this->error = error;
+            to_call.swap(callbacks);
+        }
+        cv.notify_all();
+        for (auto &callback : to_call) {
+            callback();
+        }
+    }
+} // namespace rpf
@@ -0,0 +1,701 @@
+#include "trajectory/incrementalgenerator.h"
+#include "trajectory/basictrajectory.h"
+#include "trajectory/tankdrivetrajectory.h"
+#include "util/instrumentation.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace rpf {
+
+    /*
+     * Abandon all hope, ye who enter here.
+     */
+
+    /*
+     * The algorithm used to generate these trajectories are based almost entirely on the algorithm
+     * from Team 254 The Cheesy Poofs. Video here: https://youtu.be/8319J1BEHwM
+     */
+
+    namespace {
+        // The number of samples processed between checks of the time budget in step()
+        constexpr int STEP_CHUNK = 256;
+        // The number of samples processed between checks of the cancellation token in run()
+        constexpr int CANCEL_CHUNK = 1024;
+
+        // Frees the memory of a vector, which clear() does not do
+        template <typename T>
+        void release(std::vector<T> &v) {
+            std::vector<T>().swap(v);
+        }
+    } // namespace
+
+    IncrementalGenerator::IncrementalGenerator(const RobotSpecs &specs,
+            const TrajectoryParams &params, bool tank, bool streaming)
+            : specs(specs), params(params), tank(tank), streaming(streaming),
+              n(params.sample_count), total_work(0),
+              limits(specs, params.is_tank ? specs.base_width / 2 : 0) {
+        // The path is measured and sampled by the first phases
+        sampling = new SampledPath(params, specs.base_width, false);
+        geometry.reset(sampling);
+        init();
+    }
+
+    IncrementalGenerator::IncrementalGenerator(const RobotSpecs &specs,
+            std::shared_ptr<const SampledPath> geometry, bool tank, bool streaming)
+            : specs(specs), params(geometry->get_params()), tank(tank), streaming(streaming),
+              n(geometry->size()), total_work(0), geometry(geometry),
+              limits(specs, geometry->get_params().is_tank ? specs.base_width / 2 : 0) {
+        if (params.is_tank && specs.base_width != geometry->get_base_width()) {
+            throw std::invalid_argument("Base width must be the same as the sampled path's");
+        }
+        init();
+    }
+
+    void IncrementalGenerator::init() {
+        if (tank && !params.is_tank) {
+            throw std::invalid_argument("Trajectory params must be tank");
+        }
+
+        for (int p = 0; p < static_cast<int>(Phase::DONE); p++) {
+            total_work += phase_length(static_cast<Phase>(p));
+        }
+
+        // This array stores the theoretical max velocity at each point in this trajectory
+        // This is needed for tank drive, since the robot has to slow down when turning
+        // For regular basic trajectories every element of this array is set to the max velocity
+        mv.reserve(n);
+        dk.reserve(n);
+        /*
+         * This array holds the difference in time between two moments.
+         * During the forward and backwards passes, the time difference can be computed just using
+         * simple division. If computed at the end, they would require more expensive calls to
+         * sqrt().
+         */
+        time_diff.reserve(n - 1);
+        if (params.is_tank && !tank) {
+            // pathr is accessed by the TankDriveTrajectory constructor later
+            // It stores the radius of each of the sample points along the path
+            // Note that pathr is not initialized
+            pathr = std::make_shared<std::vector<double>>();
+            pathr->reserve(n);
+        }
+        /*
+         * "Moments" represent a moment in time.
+         * Each moment has a position, velocity, acceleration and time. The trajectory is made of a
+         * collection of these generated Moments. Using them, at any given time we can (roughly, but
+         * closely enough) determine the position, velocity and acceleration the robot is supposed
+         * to be at.
+         */
+        moments.reserve(n);
+
+        if (streaming) {
+            // The trajectory is handed out before it is done, and the settled moments go straight
+            // into it
+            if (tank) {
+                stream_tank.reset(new TankDriveTrajectory(*this));
+                stream_tank->moments->reserve(n);
+            }
+            else {
+                stream_basic.reset(new BasicTrajectory(*this));
+                stream_basic->moments->reserve(n);
+            }
+        }
+    }
+
+    bool IncrementalGenerator::step(double budget_us) {
+        if (phase >= Phase::DONE) {
+            check_finished();
+            return true;
+        }
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double, std::micro>(budget_us));
+        try {
+            do {
+                advance(STEP_CHUNK);
+            } while (phase < Phase::DONE && std::chrono::steady_clock::now() < deadline);
+        }
+        catch (...) {
+            fail();
+            throw;
+        }
+        return is_done();
+    }
+
+    void IncrementalGenerator::run(const CancellationToken *token) {
+        if (phase >= Phase::DONE) {
+            check_finished();
+            return;
+        }
+        try {
+            while (phase < Phase::DONE) {
+                // Without a token each phase is run in one go
+                advance(token ? CANCEL_CHUNK : std::numeric_limits<int>::max());
+                check_cancelled(token);
+            }
+        }
+        catch (...) {
+            fail();
+            throw;
+        }
+    }
+
+    void IncrementalGenerator::check_finished() const {
+        if (phase == Phase::FAILED) {
+            std::rethrow_exception(error);
+        }
+        if (phase == Phase::TAKEN) {
+            throw std::runtime_error("The trajectory has already been taken");
+        }
+    }
+
+    void IncrementalGenerator::fail() {
+        error = std::current_exception();
+        phase = Phase::FAILED;
+        // Everything generated so far is useless, so free it right away
+        geometry = nullptr;
+        sampling = nullptr;
+        release(mv);
+        release(dk);
+        release(time_diff);
+        release(moments);
+        release(tank_moments);
+        pathr = nullptr;
+    }
+
+    double IncrementalGenerator::progress() const {
+        if (phase >= Phase::DONE) {
+            return phase == Phase::FAILED ? 0 : 1;
+        }
+        return static_cast<double>(finished + index) / total_work;
+    }
+
+    std::shared_ptr<BasicTrajectory> IncrementalGenerator::get_basic() {
+        check_done(false);
+        if (streaming) {
+            return stream_basic;
+        }
+        return std::shared_ptr<BasicTrajectory>(new BasicTrajectory(*this));
+    }
+
+    std::shared_ptr<TankDriveTrajectory> IncrementalGenerator::get_tank() {
+        check_done(true);
+        if (streaming) {
+            return stream_tank;
+        }
+        return std::shared_ptr<TankDriveTrajectory>(new TankDriveTrajectory(*this));
+    }
+
+    void IncrementalGenerator::check_done(bool tank) const {
+        if (phase == Phase::FAILED) {
+            std::rethrow_exception(error);
+        }
+        if (streaming) {
+            if (tank != this->tank) {
+                throw std::runtime_error(tank ? "Not generating a tank drive trajectory"
+                                              : "Generating a tank drive trajectory");
+            }
+            if (available_count == 0) {
+                throw std::runtime_error("No moments are available yet");
+            }
+            return;
+        }
+        if (phase == Phase::TAKEN) {
+            throw std::runtime_error("The trajectory has already been taken");
+        }
+        if (phase != Phase::DONE) {
+            throw std::runtime_error("Generation is not done");
+        }
+        if (tank != this->tank) {
+            throw std::runtime_error(tank ? "Not generating a tank drive trajectory"
+                                          : "Generating a tank drive trajectory");
+        }
+    }
+
+    void IncrementalGenerator::advance(int chunk) {
+        int length = phase_length(phase);
+        if (length == 0) {
+            // e.g. the sampling phases when the path is already sampled
+            next_phase();
+            return;
+        }
+        int end = index + std::min(chunk, length - index);
+        switch (phase) {
+        case Phase::LENGTH:
+            sampling->measure(index, end);
+            break;
+        case Phase::SAMPLE:
+            sample(index, end);
+            break;
+        case Phase::LIMITS:
+            limit(index, end);
+            break;
+        case Phase::FORWARD:
+            forward(index, end);
+            break;
+        case Phase::BACKWARD:
+            backward(index, end);
+            break;
+        case Phase::TIMES:
+            fill_times(index, end);
+            break;
+        case Phase::STREAM:
+            stream(index, end);
+            break;
+        default:
+            return;
+        }
+        index = end;
+        if (index == length) {
+            next_phase();
+        }
+    }
+
+    int IncrementalGenerator::phase_length(Phase phase) const {
+        if (streaming && phase != Phase::LENGTH) {
+            return phase == Phase::STREAM ? n : 0;
+        }
+        switch (phase) {
+        case Phase::LENGTH:
+        case Phase::SAMPLE:
+            return sampling ? n : 0;
+        case Phase::LIMITS:
+        case Phase::TIMES:
+            return n;
+        case Phase::FORWARD:
+        case Phase::BACKWARD:
+            return n - 1;
+        default:
+            return 0;
+        }
+    }
+
+    void IncrementalGenerator::next_phase() {
+        finished += phase_length(phase);
+        index = 0;
+        if (streaming) {
+            phase = phase == Phase::LENGTH ? Phase::STREAM : Phase::DONE;
+        }
+        else {
+            phase = static_cast<Phase>(static_cast<int>(phase) + 1);
+            if (phase == Phase::STREAM) {
+                phase = Phase::DONE;
+            }
+        }
+
+        switch (phase) {
+        case Phase::SAMPLE:
+            prepare_sample();
+            break;
+        case Phase::LIMITS:
+            prepare_limits();
+            break;
+        case Phase::FORWARD:
+            prepare_forward();
+            break;
+        case Phase::BACKWARD:
+            prepare_backward();
+            break;
+        case Phase::TIMES:
+            prepare_times();
+            break;
+        case Phase::STREAM:
+            prepare_sample();
+            prepare_limits();
+            break;
+        case Phase::DONE:
+            // In streaming mode, the last settle() already got here
+            settled = n;
+            available_count = n;
+            settled_time = moments[n - 1].time;
+            // The passes are done a chunk at a time, but each is recorded as one time
+            RPF_PROBE_RECORD(forward_time);
+            RPF_PROBE_RECORD(backward_time);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void IncrementalGenerator::prepare_sample() {
+        if (sampling) {
+            sampling->prepare();
+        }
+    }
+
+    void IncrementalGenerator::prepare_limits() {
+        dpi = geometry->dpi;
+        constraints = geometry->constraints;
+        for (auto &constraint : constraints) {
+            if (std::abs(constraint.second) > specs.max_v) {
+                throw std::invalid_argument(
+                        "Waypoint velocity constraint is greater than the max velocity");
+            }
+        }
+    }
+
+    void IncrementalGenerator::prepare_forward() {
+        // Initialize the first moment of the array
+        // If the velocity is specified then follow the constraints
+        if (!std::isnan(params.waypoints[0].velocity)) {
+            moments.push_back(
+                    BasicMoment(0, params.waypoints[0].velocity, 0, geometry->headings[0]));
+            // Mark the first moment as constrained so that it cannot be changed
+            constrained.insert(0);
+        }
+        else {
+            moments.push_back(BasicMoment(0, 0, 0, geometry->headings[0]));
+        }
+    }
+
+    void IncrementalGenerator::prepare_backward() {
+        // Prepare for backwards pass by setting the last moment's data to the desired values
+        double end_vel = params.waypoints[params.waypoints.size() - 1].velocity;
+        moments[moments.size() - 1].accel = 0;
+        moments[moments.size() - 1].vel = std::isnan(end_vel) ? 0 : end_vel;
+    }
+
+    void IncrementalGenerator::prepare_times() {
+        // Set initial facing direction for all moments
+        init_facing = moments[0].get_afacing();
+        // The moments are constructed without a time, so the first one has to be set as well
+        moments[0].time = 0;
+        if (tank && !streaming) {
+            tank_moments.reserve(moments.size());
+        }
+    }
+
+    void IncrementalGenerator::sample(int begin, int end) {
+        if (sampling) {
+            sampling->sample(begin, end);
+        }
+    }
+
+    void IncrementalGenerator::limit(int begin, int end) {
+        auto &k = geometry->k;
+        if (pathr) {
+            // Store a value into pathr for use by TankDriveTrajectory later
+            for (int i = begin; i < end; i++) {
+                pathr->push_back(1 / k[i]);
+            }
+        }
+        // dk/ds for the interval between every two samples
+        // This uses the same finite differences that are used to compute the wheel accelerations
+        // of tank drive trajectories, so that the limits hold for the generated moments
+        for (int i = begin; i < end; i++) {
+            dk.push_back(i < n - 1 ? (k[i + 1] - k[i]) / dpi : 0);
+        }
+        // The backwards pass fills in the time differences from the end, so they have to exist
+        // before the passes start
+        time_diff.resize(std::min(end, n - 1), std::numeric_limits<double>::quiet_NaN());
+
+        // The acceleration limits are applied to each wheel during the passes, instead of the
+        // center of the robot
+        // Lower the max velocities to where the robot can still keep a constant velocity through
+        // the intervals on both sides, and to the voltage limit if there is one
+        for (int i = begin; i < end; i++) {
+            // If the trajectory is just a basic trajectory, there's no need to slow down, so every
+            // point's max velocity is the specified max velocity.
+            // Tank drive trajectories require extra processing
+            /*
+             * The maximum speed for the entire robot is computed with a formula.
+             * Derivation here: Start with the equations:
+             * 1. (r - l) / b = w, where l and r are the wheel velocities, b is the base
+             * width and w (omega) is the angular velocity.
+             * 2. (l + r) / 2 = V, where l and r are the wheel velocities, and V is the
+             * overall velocity
+             * 3. w = V / R, where w is the angular velocity, V is the overall velocity, and
+             * R is the radius of the path.
+             *
+             * 1. Rearrange equation 1: wb = r - l, l = r - wb
+             * 2. Since we want the robot to go as fast as possible, the faster wheel has
+             * velocity Vmax
+             * 3. Assuming the right side is faster, r = Vmax, and by 1, l = Vmax - wb
+             * 4. Equation 2 becomes: (2Vmax - wb) / 2 = V
+             * 5. Substitute in equation 3, (2Vmax - (V / R)b) / 2 = V
+             * 6. Now solve for V: 2Vmax - (V / R)b = 2V, 2V + (V / R)b = 2Vmax,
+             * V(2 + b / R) = 2Vmax, V = 2Vmax / (2 + b / R), V = Vmax / (1 + b / (2R))
+             * 7. The curvature k = 1 / R, so V = Vmax / (1 + bk / 2)
+             */
+            double v = params.is_tank ? specs.max_v / (1 + specs.base_width / 2 * std::abs(k[i]))
+                                      : specs.max_v;
+            double x = limits.max_vel_sq(k[i], dk[i]);
+            if (i > 0) {
+                x = std::min(x, limits.max_vel_sq(k[i], dk[i - 1]));
+            }
+            mv.push_back(std::min(v, std::sqrt(x)));
+        }
+    }
+
+    void IncrementalGenerator::forward(int begin, int end) {
+        RPF_PROBE_ADD(forward_time);
+        auto &k = geometry->k;
+        auto &headings = geometry->headings;
+        for (int i = begin + 1; i < end + 1; i++) {
+            double dist = i * dpi;
+
+            // Since the additional velocity constraints are sorted from shortest path length to
+            // longest, we can check if we just surpassed one to determine whether we're on the
+            // point. Then, remove it so the process still works.
+            if (!constraints.empty() && dist >= constraints.front().first) {
+                auto constraint = constraints.front();
+                constraints.pop_front();
+                // If the velocity is higher than the current, perform some extra checks and
+                // computations
+                if (constraint.second > moments[i - 1].vel) {
+                    double accel = (constraint.second * constraint.second -
+                                           moments[i - 1].vel * moments[i - 1].vel) /
+                                   (2 * dpi);
+                    double reachable = limits.step_forward(k[i - 1], dk[i - 1],
+                            moments[i - 1].vel * moments[i - 1].vel,
+                            std::numeric_limits<double>::infinity(), dpi);
+                    if (constraint.second * constraint.second > reachable) {
+                        throw std::invalid_argument("Waypoint velocity constraint cannot be met");
+                    }
+                    // Otherwise set accel and compute time diff
+                    moments[i - 1].accel = accel;
+                    time_diff[i - 1] = (constraint.second - moments[i - 1].vel) / accel;
+                }
+                // Ignore otherwise, it will be handled by the backwards pass
+
+                // Make the new moment and mark it as constrained
+                moments.push_back(BasicMoment(dist, constraint.second, 0, headings[i]));
+                constrained.insert(i);
+                continue;
+            }
+
+            // Otherwise do normal processing
+            // Check if our velocity is less than the max at that point
+            if (moments[i - 1].vel < mv[i]) {
+                // If we can accelerate then check the maximum velocity we can accelerate to
+                // The step is capped at the max velocity so that the limits of both wheels
+                // still hold if the max velocity is reached
+                double maxv = std::sqrt(limits.step_forward(k[i - 1], dk[i - 1],
+                        moments[i - 1].vel * moments[i - 1].vel, mv[i] * mv[i], dpi));
+                double vel;
+                if (maxv >= mv[i]) {
+                    // If it's more than the max then calculate the acceleration needed to reach
+                    // the max
+                    double accel =
+                            (mv[i] * mv[i] - moments[i - 1].vel * moments[i - 1].vel) / (2 * dpi);
+                    vel = mv[i];
+                    moments[i - 1].accel = accel;
+                }
+                else {
+                    // Otherwise set the velocity to be the max and set the previous moment's
+                    // acceleration
+                    vel = maxv;
+                    moments[i - 1].accel =
+                            (maxv * maxv - moments[i - 1].vel * moments[i - 1].vel) / (2 * dpi);
+                }
+                // Add the new moment and compute the time diff
+                moments.push_back(BasicMoment(dist, vel, 0, headings[i]));
+                // time diff computation is trivial since we can use the velocity differences
+                time_diff[i - 1] = (vel - moments[i - 1].vel) / moments[i - 1].accel;
+            }
+            else {
+                // If we can't accelerate just insert a normal moment with zero acceleration
+                // The backwards pass will handle the rest
+                moments.push_back(BasicMoment(dist, mv[i], 0, headings[i]));
+            }
+        }
+    }
+
+    void IncrementalGenerator::backward(int begin, int end) {
+        RPF_PROBE_ADD(backward_time);
+        auto &k = geometry->k;
+        for (int i = n - 2 - begin; i > n - 2 - end; i--) {
+            // Only do processing if the velocity of this moment is greater than the next
+            // i.e. deceleration is needed
+            if (moments[i].vel > moments[i + 1].vel) {
+                // Calculate max velocity like in the forwards pass but backwards this time
+                double maxv = std::sqrt(limits.step_backward(k[i], dk[i],
+                        moments[i + 1].vel * moments[i + 1].vel, moments[i].vel * moments[i].vel,
+                        dpi));
+
+                double vel;
+                // Compare with the velocity set by the forwards pass
+                // If the velocity from the forwards pass is possible, then just set the
+                // acceleration
+                if (maxv >= moments[i].vel) {
+                    double accel = (moments[i].vel * moments[i].vel -
+                                           moments[i + 1].vel * moments[i + 1].vel) /
+                                   (2 * dpi);
+                    moments[i].accel = -accel;
+                    vel = moments[i].vel;
+                }
+                else {
+                    // Otherwise, set deceleration to max
+                    // If the moment is constrained, throw an exception
+                    if (constrained.count(i)) {
+                        throw std::invalid_argument("Waypoint velocity constraint cannot be met");
+                    }
+                    vel = maxv;
+                    moments[i].accel =
+                            (moments[i + 1].vel * moments[i + 1].vel - maxv * maxv) / (2 * dpi);
+                }
+
+                moments[i].vel = vel;
+                // Compute the time diff with the velocities
+                time_diff[i] = (moments[i + 1].vel - vel) / moments[i].accel;
+            }
+        }
+    }
+
+    void IncrementalGenerator::fill_times(int begin, int end) {
+        auto &k = geometry->k;
+        for (int i = begin; i < end; i++) {
+            moments[i].init_facing = init_facing;
+            if (i == 0) {
+                if (tank) {
+                    TankDriveTrajectory::push_moment(tank_moments, nullptr, moments[0], k[0],
+                            specs.base_width / 2, init_facing);
+                }
+                continue;
+            }
+            // If we already have a time diff, then use that to calculate the next time
+            if (!std::isnan(time_diff[i - 1])) {
+                moments[i].time = moments[i - 1].time + time_diff[i - 1];
+            }
+            else {
+                // If there is no time diff, it must mean that the acceleration is equal to zero
+                // In this case we can simply use the position difference to calculate time
+                // difference
+                double dt = (moments[i].pos - moments[i - 1].pos) / moments[i - 1].vel;
+                moments[i].time = moments[i - 1].time + dt;
+            }
+            // The tank drive moments are generated along with the times, instead of in a separate
+            // pass afterwards
+            if (tank) {
+                TankDriveTrajectory::push_moment(tank_moments, &moments[i - 1], moments[i], k[i],
+                        specs.base_width / 2, init_facing);
+            }
+        }
+    }
+
+    void IncrementalGenerator::stream(int begin, int end) {
+        sample(begin, end);
+        // dk/ds for a sample needs the curvature of the next one, so the limits are a sample
+        // behind until the end
+        int next_limited = end == n ? n : end - 1;
+        limit(limited, next_limited);
+        limited = next_limited;
+        if (begin == 0) {
+            prepare_forward();
+        }
+
+        // The forwards pass needs the limits on both sides of a sample
+        if (limited - 1 > frontier) {
+            forward(frontier, limited - 1);
+            frontier = limited - 1;
+        }
+
+        if (frontier == n - 1) {
+            // Everything is known, so the rest is settled like it normally would be
+            prepare_backward();
+            settle(settled, n);
+        }
+        else if (frontier >= next_probe) {
+            int end_settled = find_settled();
+            // Finding the settled samples goes back over everything after them, so it is only
+            // done again once the frontier has moved on by half of that, which keeps it to about
+            // two steps per sample
+            next_probe = frontier + (frontier - end_settled) / 2;
+            if (end_settled > settled) {
+                settle(settled, end_settled);
+            }
+        }
+    }
+
+    int IncrementalGenerator::find_settled() const {
+        // The samples after the frontier are not known yet, but the worst they can do is make the
+        // robot stop right at it
+        // Going backwards from there with a lower bound of the step gives the lowest velocity the
+        // backwards pass could possibly set at each sample, and once it gets up to what the
+        // forwards pass has, nothing after the frontier can make a difference any more
+        // The checks are the same as the ones of the backwards pass below
+        auto &k = geometry->k;
+        double vel = 0;
+        for (int i = frontier - 1; i > settled; i--) {
+            // The backwards pass does nothing if the robot does not have to decelerate
+            if (moments[i].vel <= vel) {
+                return i;
+            }
+            double maxv = std::sqrt(limits.step_backward_bound(k[i], dk[i], vel * vel,
+                    moments[i + 1].vel * moments[i + 1].vel, moments[i].vel * moments[i].vel,
+                    dpi));
+            if (maxv >= moments[i].vel) {
+                return i;
+            }
+            vel = maxv;
+        }
+        return settled;
+    }
+
+    void IncrementalGenerator::settle(int begin, int end) {
+        // The backwards pass starts from the sample after the range, or the last sample
+        int steps_begin = n - 1 - std::min(end, n - 1);
+        backward(steps_begin, n - 1 - begin);
+        if (begin == 0) {
+            prepare_times();
+            if (stream_basic) {
+                stream_basic->init_facing = init_facing;
+            }
+            else {
+                stream_tank->init_facing = init_facing;
+            }
+        }
+        fill_times(begin, end);
+        settled = end;
+        if (stream_basic) {
+            stream_basic->moments->insert(stream_basic->moments->end(), moments.begin() + begin,
+                    moments.begin() + end);
+            available_count = end;
+            settled_time = moments[end - 1].time;
+        }
+        else {
+            // The accelerations of a tank drive moment are only set when the next one is pushed,
+            // so the last one is held back until then, unless it is the end of the trajectory
+            auto last = end == n ? tank_moments.end() : tank_moments.end() - 1;
+            auto &out = *stream_tank->moments;
+            out.insert(out.end(), tank_moments.begin(), last);
+            tank_moments.erase(tank_moments.begin(), last);
+            available_count = out.size();
+            if (!out.empty()) {
+                settled_time = out.back().time;
+            }
+        }
+    }
+
+    void IncrementalGenerator::take(BasicTrajectory &traj) {
+        if (streaming) {
+            // The trajectory is made at the start, and the moments are added as they are settled
+            traj.path = geometry->path;
+            traj.patht = geometry->patht;
+            traj.pathr = pathr;
+            return;
+        }
+        phase = Phase::TAKEN;
+        traj.path = geometry->path;
+        *traj.moments = std::move(moments);
+        traj.init_facing = init_facing;
+        traj.patht = geometry->patht;
+        traj.pathr = std::move(pathr);
+    }
+
+    void IncrementalGenerator::take(TankDriveTrajectory &traj) {
+        if (streaming) {
+            traj.path = geometry->path;
+            traj.patht = geometry->patht;
+            return;
+        }
+        phase = Phase::TAKEN;
+        traj.path = geometry->path;
+        *traj.moments = std::move(tank_moments);
+        traj.init_facing = init_facing;
+        traj.patht = geometry->patht;
+    }
+} // namespace rpf
@@ -0,0 +1,107 @@
+#include "trajectory/sampledpath.h"
+#include "util/instrumentation.h"
+#include <cmath>
+
+namespace rpf {
+
+    SampledPath::SampledPath(const TrajectoryParams &params, double base_width)
+            : SampledPath(params, base_width, true) {
+    }
+
+    SampledPath::SampledPath(const TrajectoryParams &params, double base_width, bool sample)
+            : params(params), base_width(base_width), n(params.sample_count) {
+        // Make the path
+        path = std::make_shared<Path>(params.waypoints, params.alpha, params.type);
+        if (params.is_tank) {
+            path->set_base(base_width / 2);
+        }
+
+        // patht is accessed by the TankDriveTrajectory constructor later
+        // It is also used to find the position given a time later
+        patht->reserve(n);
+        // This array stores the direction of the robot at each moment
+        // Directions are generated in a separate process as the velocities and accelerations
+        headings.reserve(n);
+        // This array stores the curvature of the path at each sample
+        // It is used to apply the limits to each wheel of tank drive robots, and stays all zeros
+        // for basic trajectories
+        // None of the arrays are filled in here, so that the memory is only touched bit by bit as
+        // the samples are taken, instead of all at once
+        k.reserve(n);
+
+        if (sample) {
+            measure(0, n);
+            prepare();
+            this->sample(0, n);
+        }
+    }
+
+    void SampledPath::measure(int begin, int end) {
+        path->compute_len(n, begin, end);
+    }
+
+    void SampledPath::prepare() {
+        /*
+         * Because most parametric polynomials don't have constant speed (i.e. the magnitude of the
+         * derivative is non-constant), we use some special processing to make samples the same
+         * physical distance apart. Instead of getting positions from the path and iterating the
+         * time, we calculate the whole length of the path, and make each sample a constant length
+         * away. The time value can then be found by calling the s2T method in Path, and any special
+         * processing can be done with that.
+         */
+        // Instead of iterating over t, we iterate over s, which represents the fraction of the
+        // total distance ds is the difference in the fraction of the total path length travelled
+        // for each iteration
+        ds = 1.0 / (n - 1);
+        double total = path->get_len();
+        // dpi stands for Distance Per Iteration, it is the distance travelled along the path for
+        // each iteration
+        dpi = total / (n - 1);
+
+        // Extract and organize all the additional velocity constraints from the waypoints
+        // The first element of each Pair of doubles holds the path distance for the constraint
+        // The second element holds the velocity
+        // Use a list because random access is never needed
+        auto &waypoints = params.waypoints;
+        // Since waypoints are spaced evenly though time we can calculate the constant difference
+        // here
+        double wpdt = 1.0 / (waypoints.size() - 1);
+        for (size_t i = 1; i < waypoints.size() - 1; i++) {
+            if (!std::isnan(waypoints[i].velocity)) {
+                // Use t2S to find the fractional distance, then multiply by the total distance
+                constraints.push_back(
+                        std::make_pair(path->t2s(i * wpdt) * total, waypoints[i].velocity));
+            }
+        }
+    }
+
+    void SampledPath::sample(int begin, int end) {
+        RPF_PROBE_SCOPE(SAMPLE);
+        // The segment type is found once, so that the path is evaluated without virtual calls
+        path->visit([&](auto tag) {
+            PathEvaluator<typename decltype(tag)::type> eval(*path);
+            PathSample sample;
+            for (int i = begin; i < end; i++) {
+                // Call s2T to translate between length and time
+                // The samples are in order, so s2t can walk the lookup table instead of searching
+                double t = path->s2t(ds * i, s2t_cursor);
+                // Store a value into patht for use by TankDriveTrajectory later
+                patht->push_back(t);
+                // Everything needed from the path is computed in one go
+                eval.sample(t, sample);
+                // The heading is generated as a by-product
+                headings.push_back(sample.heading);
+
+                if (!params.is_tank) {
+                    // Basic trajectories don't need to slow down in turns
+                    k.push_back(0);
+                    continue;
+                }
+                // Skip the curvature on segments where it can never make a difference to the
+                // wheels, e.g. straight lines
+                k.push_back(base_width / 2 * path->curvature_bound_at(t) >= 1e-9 ? sample.curvature
+                                                                                 : 0);
+            }
+        });
+    }
+} // namespace rpf
@@ -1,88 +1,139 @@
 #include "trajectory/tankdrivetrajectory.h"
+#include "util/instrumentation.h"
+#include <cmath>
 
 namespace rpf {
 
     TankDriveTrajectory::TankDriveTrajectory(const BasicTrajectory &traj)
-            : path(traj.path), patht(traj.patht), specs(traj.specs), params(traj.params),
+            : path(traj.path), time_scale(traj.time_scale), transform(traj.transform),
+              patht(traj.patht), specs(traj.specs), params(traj.params),
               init_facing(traj.init_facing) {
+        RPF_PROBE_SCOPE(TANK_INTEGRATE);
         if (!params.is_tank) {
             throw std::invalid_argument("Base trajectory must be tank");
         }
 
         path->set_base(specs.base_width / 2);
-        moments.reserve(traj.moments.size());
-        // Initialize first moment
-        if (!std::isnan(params.waypoints[0].velocity)) {
-            double v = traj.moments[0].vel;
-            double d = v / (*traj.pathr)[0] * specs.base_width / 2;
-            // Apply the velocity formula (derived below) to find the wheel velocities for the two
-            // wheels
-            moments.push_back(
-                    TankDriveMoment(0, 0, v - d, v + d, 0, 0, traj.moments[0].heading, 0));
+        // The moments are made from the ones that are not scaled or transformed, and the view is
+        // kept
+        auto &moments = *this->moments;
+        auto &center = *traj.moments;
+        moments.reserve(center.size());
+        push_moment(moments, nullptr, center[0], 1 / (*traj.pathr)[0], specs.base_width / 2,
+                init_facing);
+        for (size_t i = 1; i < center.size(); i++) {
+            push_moment(moments, &center[i - 1], center[i], 1 / (*traj.pathr)[i],
+                    specs.base_width / 2, init_facing);
         }
-        else {
-            moments.push_back(TankDriveMoment(0, 0, 0, 0, 0, 0, traj.moments[0].heading, 0));
+        if (traj.is_window()) {
+            set_window(traj.window_begin, traj.window_end);
         }
+    }
 
-        // Use numerical integration for each moment to figure out the values
-        // This variable keeps track of where the wheels were in the last iteration.
-        auto init = path->wheels_at(0);
-        moments[0].init_facing = traj.init_facing;
-        for (size_t i = 1; i < traj.moments.size(); i++) {
-            // First find where the wheels are at this moment and integrate the length
-            auto wheels = path->wheels_at((*traj.patht)[i]);
-            double dl = init.first.dist(wheels.first);
-            double dr = init.second.dist(wheels.second);
-            double dt = traj.moments[i].time - traj.moments[i - 1].time;
+    TankDriveTrajectory::TankDriveTrajectory(
+            const RobotSpecs &specs, const TrajectoryParams &params)
+            : TankDriveTrajectory(specs, params, nullptr) {
+    }
 
-            // Find out the velocity of the two wheels
-            /*
-             * The formula for velocity is derived as follows:
-             * Start with the equation:
-             * 1. w = v/r, where w is the angular velocity, r is the radius of the path, and v is
-             * the velocity
-             *
-             * 1. From the equation we can get v = wr
-             * 2. Let b represent the base radius; then, the radius for the left wheel is r - b, the
-             * radius for the right wheel is r + b
-             * 3. Substitute r: v1 = w(r - b), v2 = w(r + b), where v1 is the left wheel velocity,
-             * v2 is the right wheel velocity
-             * 4. Substitute w: v1 = (v/r) (r - b), v2 = (v/r) (r + b)
-             * 5. Distribute: v1 = v - (v/r) * b, v2 = v + (v/r) * b
-             *
-             * The nice thing about using path radius to figure out the velocity is now we can have
-             * negative velocities when the turn is too tight and the wheel has to move backwards,
-             * unlike the distance difference which is always positive.
-             */
-            init = wheels;
-            double d = traj.moments[i].vel / (*traj.pathr)[i] * (specs.base_width / 2);
-            double lv = traj.moments[i].vel - d;
-            double rv = traj.moments[i].vel + d;
-
-            // If the corresponding wheel velocity is negative, then the distance difference must
-            // also be negative
-            if (lv < 0) {
-                dl = -dl;
-            }
-            if (rv < 0) {
-                dr = -dr;
-            }
+    TankDriveTrajectory::TankDriveTrajectory(const RobotSpecs &specs,
+            const TrajectoryParams &params, const CancellationToken &token)
+            : TankDriveTrajectory(specs, params, &token) {
+    }
+
+    TankDriveTrajectory::TankDriveTrajectory(const RobotSpecs &specs,
+            const TrajectoryParams &params, const CancellationToken *token)
+            : specs(specs), params(params) {
+        // The tank drive moments are generated along with the center moments, which are thrown
+        // away afterwards
+        IncrementalGenerator gen(specs, params, true);
+        gen.run(token);
+        gen.take(*this);
+    }
+
+    TankDriveTrajectory::TankDriveTrajectory(
+            const RobotSpecs &specs, std::shared_ptr<const SampledPath> geometry)
+            : specs(specs), params(geometry->get_params()) {
+        // Only the timing is generated, since the path is already sampled
+        IncrementalGenerator gen(specs, geometry, true);
+        gen.run();
+        gen.take(*this);
+    }
+
+    TankDriveTrajectory::TankDriveTrajectory(IncrementalGenerator &gen)
+            : specs(gen.specs), params(gen.params) {
+        gen.take(*this);
+    }
 
-            // Create a new moment and set the acceleration of the last moment
-            moments.push_back(TankDriveMoment(moments[i - 1].l_pos + dl, moments[i - 1].r_pos + dr,
-                    lv, rv, 0, 0, traj.moments[i].heading, traj.moments[i].time, traj.init_facing));
-            moments[i - 1].l_accel = (lv - moments[i - 1].l_vel) / dt;
-            moments[i - 1].r_accel = (rv - moments[i - 1].r_vel) / dt;
+    void TankDriveTrajectory::push_moment(std::vector<TankDriveMoment> &moments,
+            const BasicMoment *prev, const BasicMoment &cur, double k, double base_radius,
+            double init_facing) {
+        // Find out the velocity of the two wheels
+        /*
+         * The formula for velocity is derived as follows:
+         * Start with the equation:
+         * 1. w = v/r, where w is the angular velocity, r is the radius of the path, and v is
+         * the velocity
+         *
+         * 1. From the equation we can get v = wr
+         * 2. Let b represent the base radius; then, the radius for the left wheel is r - b, the
+         * radius for the right wheel is r + b
+         * 3. Substitute r: v1 = w(r - b), v2 = w(r + b), where v1 is the left wheel velocity,
+         * v2 is the right wheel velocity
+         * 4. Substitute w: v1 = (v/r) (r - b), v2 = (v/r) (r + b)
+         * 5. Distribute: v1 = v - (v/r) * b, v2 = v + (v/r) * b
+         *
+         * The nice thing about using path radius to figure out the velocity is now we can have
+         * negative velocities when the turn is too tight and the wheel has to move backwards.
+         */
+        double d = cur.vel * k * base_radius;
+        double lv = cur.vel - d;
+        double rv = cur.vel + d;
+        if (!prev) {
+            moments.push_back(TankDriveMoment(0, 0, lv, rv, 0, 0, cur.heading, 0, init_facing));
+            return;
         }
+
+        /*
+         * A wheel that is b away from the center follows a path with radius R - b or R + b,
+         * so for every ds the center moves, the left wheel moves ds * (1 - b / R) and the right
+         * wheel moves ds * (1 + b / R). Since ds / R = k ds = dtheta, these are ds - b dtheta
+         * and ds + b dtheta.
+         * Integrating k ds between two samples gives exactly the change in heading, so no
+         * curvature has to be sampled or integrated numerically.
+         *
+         * This is signed, so when the turn is tight enough that a wheel has to move backwards,
+         * its distance goes down.
+         */
+        double ds = cur.pos - prev->pos;
+        double dtheta = rpf::angle_diff(prev->heading, cur.heading);
+        double dt = cur.time - prev->time;
+
+        // Set the acceleration of the last moment and create a new moment
+        auto &last = moments.back();
+        last.l_accel = (lv - last.l_vel) / dt;
+        last.r_accel = (rv - last.r_vel) / dt;
+        moments.push_back(TankDriveMoment(last.l_pos + ds - base_radius * dtheta,
+                last.r_pos + ds + base_radius * dtheta, lv, rv, 0, 0, cur.heading, cur.time,
+                init_facing));
+    }
+
+    TankDriveTrajectory::TankDriveTrajectory(const TankDriveRotationProfile &rotation)
+            : rotation(std::make_shared<const TankDriveRotationProfile>(rotation)),
+              specs(rotation.get_specs()), init_facing(rotation.get_init_facing()) {
+        // There are no waypoints or path, but the trajectory is still for a tank drive
+        params.is_tank = true;
+        moments->push_back(rotation.get(0));
+        moments->push_back(rotation.get(rotation.total_time()));
     }
 
     std::pair<std::size_t, std::size_t> TankDriveTrajectory::search_moments(double t) const {
+        auto &moments = *this->moments;
         std::size_t start = 0;
         std::size_t end = moments.size() - 1;
         std::size_t mid;
 
         // Time out of range - take the last moment
-        if (t >= total_time()) {
+        if (t >= moments[moments.size() - 1].time) {
             return std::make_pair(moments.size() - 1, moments.size() - 1);
         }
 
@@ -111,8 +162,37 @@ namespace rpf {
         }
     }
 
-    TankDriveMoment TankDriveTrajectory::get(double t) const {
-        auto m = search_moments(t);
+    std::pair<std::size_t, std::size_t> TankDriveTrajectory::search_moments(
+            double t, std::size_t &cursor) const {
+        auto &moments = *this->moments;
+        // Time out of range - take the last or first moment
+        if (t >= moments[moments.size() - 1].time) {
+            cursor = moments.size() - 1;
+            return std::make_pair(cursor, cursor);
+        }
+        if (t <= moments[0].time) {
+            cursor = 0;
+            return std::make_pair(cursor, cursor);
+        }
+        // Going back in time - fall back to a binary search
+        if (cursor >= moments.size() - 1 || moments[cursor].time > t) {
+            auto m = search_moments(t);
+            cursor = m.first;
+            return m;
+        }
+        // Since t is less than the total time, this never goes past the last moment
+        while (moments[cursor + 1].time < t) {
+            cursor++;
+        }
+        if (moments[cursor].time == t) {
+            return std::make_pair(cursor, cursor);
+        }
+        return std::make_pair(cursor, cursor + 1);
+    }
+
+    TankDriveMoment TankDriveTrajectory::interpolate(
+            std::pair<std::size_t, std::size_t> m, double t) const {
+        auto &moments = *this->moments;
         // Exact match - return it
         if (m.first == m.second) {
             return moments[m.first];
@@ -136,7 +216,97 @@ namespace rpf {
         }
     }
 
+    TankDriveMoment TankDriveTrajectory::source_get(double t) const {
+        if (rotation) {
+            // The facing of the profile is not the one of the trajectory if it is mirrored front
+            // to back
+            auto moment = rotation->get(t);
+            moment.init_facing = init_facing;
+            moment.backwards = backwards;
+            return moment;
+        }
+        return interpolate(search_moments(t), t);
+    }
+
+    TankDriveMoment TankDriveTrajectory::view(TankDriveMoment moment, double t) const {
+        if (time_scale != 1 || is_window()) {
+            // Times past the ends get the moment at the end, like for the moments themselves
+            moment.time = std::min(std::max(t, 0.0), total_time());
+            moment.l_pos -= l_pos_offset;
+            moment.r_pos -= r_pos_offset;
+            moment.l_vel /= time_scale;
+            moment.r_vel /= time_scale;
+            moment.l_accel /= time_scale * time_scale;
+            moment.r_accel /= time_scale * time_scale;
+        }
+        moment.heading = transform.apply_angle(moment.heading);
+        moment.init_facing = transform.apply_angle(moment.init_facing);
+        return moment;
+    }
+
+    void TankDriveTrajectory::set_rotation_facing(double init_facing, bool backwards) {
+        this->init_facing = init_facing;
+        this->backwards = backwards;
+        for (auto &moment : *moments) {
+            moment.init_facing = init_facing;
+            moment.backwards = backwards;
+        }
+    }
+
+    void TankDriveTrajectory::set_window(double begin, double end) {
+        auto &moments = *this->moments;
+        window_begin = begin;
+        window_end = end;
+        window_first = std::upper_bound(moments.begin(), moments.end(), begin,
+                               [](double t, const TankDriveMoment &m) { return t < m.time; }) -
+                       moments.begin();
+        window_last = std::lower_bound(moments.begin(), moments.end(), end,
+                              [](const TankDriveMoment &m, double t) { return m.time < t; }) -
+                      moments.begin();
+        auto start = source_get(begin);
+        l_pos_offset = start.l_pos;
+        r_pos_offset = start.r_pos;
+    }
+
+    TankDriveMoment TankDriveTrajectory::moment(std::size_t i) const {
+        if (!is_window()) {
+            return view((*moments)[i], (*moments)[i].time * time_scale);
+        }
+        if (i == 0) {
+            return get(0);
+        }
+        if (i == moment_count() - 1) {
+            return get(total_time());
+        }
+        auto &m = (*moments)[window_first + i - 1];
+        return view(m, (m.time - window_begin) * time_scale);
+    }
+
+    TankDriveMoment TankDriveTrajectory::get(double t) const {
+        RPF_PROBE_SCOPE(QUERY);
+        // The time of the moments, which are not scaled
+        double st = source_time(t);
+        return view(source_get(st), t);
+    }
+
+    TankDriveMoment TankDriveTrajectory::get(double t, std::size_t &cursor) const {
+        RPF_PROBE_SCOPE(QUERY);
+        double st = source_time(t);
+        if (rotation) {
+            return view(source_get(st), t);
+        }
+        return view(interpolate(search_moments(st, cursor), st), t);
+    }
+
     Waypoint TankDriveTrajectory::get_pos(double t) const {
+        auto &moments = *this->moments;
+        // Positions don't change with the time scale, only when they are reached
+        t = source_time(t);
+        // The robot does not move when turning in place
+        if (rotation) {
+            return Waypoint(transform.apply(Vec2D(0, 0)),
+                    transform.apply_angle(rotation->get(t).heading));
+        }
         auto m = search_moments(t);
         // Calculate path time using lookup table
         double pt;
@@ -160,9 +330,22 @@ namespace rpf {
     }
 
     std::shared_ptr<TankDriveTrajectory> TankDriveTrajectory::mirror_lr() const {
+        // Mirroring a turn in place in either direction makes it turn the other way
+        if (rotation) {
+            auto traj = std::make_shared<TankDriveTrajectory>(TankDriveRotationProfile(
+                    specs, -rotation->get_angle(), rotation->get_init_facing()));
+            traj->set_rotation_facing(init_facing, backwards);
+            traj->time_scale = time_scale;
+            traj->transform = transform;
+            if (is_window()) {
+                traj->set_window(window_begin, window_end);
+            }
+            return traj;
+        }
         auto p = path->mirror_lr();
         double ref = params.waypoints[0].heading;
 
+        auto &moments = *this->moments;
         std::vector<TankDriveMoment> m;
         m.reserve(moments.size());
         for (const auto &moment : moments) {
@@ -173,13 +356,34 @@ namespace rpf {
             m.push_back(nm);
         }
 
-        return std::shared_ptr<TankDriveTrajectory>(
+        auto traj = std::shared_ptr<TankDriveTrajectory>(
                 new TankDriveTrajectory(p, std::move(m), backwards, specs, params));
+        traj->time_scale = time_scale;
+        traj->transform = transform;
+        if (is_window()) {
+            traj->set_window(window_begin, window_end);
+        }
+        return traj;
     }
     std::shared_ptr<TankDriveTrajectory> TankDriveTrajectory::mirror_fb() const {
+        // Driving a turn in place backwards turns the other way, with the headings flipped around
+        // the same line as the ones of a path below, which makes them face the other way
+        if (rotation) {
+            auto traj = std::make_shared<TankDriveTrajectory>(
+                    TankDriveRotationProfile(specs, -rotation->get_angle(),
+                            rpf::restrict_angle(rotation->get_init_facing() + rpf::pi)));
+            traj->set_rotation_facing(init_facing, !backwards);
+            traj->time_scale = time_scale;
+            traj->transform = transform;
+            if (is_window()) {
+                traj->set_window(window_begin, window_end);
+            }
+            return traj;
+        }
         auto p = path->mirror_fb();
         double ref = rpf::restrict_angle(params.waypoints[0].heading + rpf::pi / 2);
 
+        auto &moments = *this->moments;
         std::vector<TankDriveMoment> m;
         m.reserve(moments.size());
         for (const auto &moment : moments) {
@@ -189,12 +393,35 @@ namespace rpf {
             nm.backwards = !backwards;
             m.push_back(nm);
         }
-        return std::shared_ptr<TankDriveTrajectory>(
+        auto traj = std::shared_ptr<TankDriveTrajectory>(
                 new TankDriveTrajectory(p, std::move(m), !backwards, specs, params));
+        traj->time_scale = time_scale;
+        traj->transform = transform;
+        if (is_window()) {
+            traj->set_window(window_begin, window_end);
+        }
+        return traj;
     }
     std::shared_ptr<TankDriveTrajectory> TankDriveTrajectory::retrace() const {
+        // Turn back from where the turn ended
+        if (rotation) {
+            auto traj = std::make_shared<TankDriveTrajectory>(TankDriveRotationProfile(specs,
+                    -rotation->get_angle(),
+                    restrict_angle(rotation->get_init_facing() + rotation->get_angle())));
+            traj->set_rotation_facing(
+                    restrict_angle(init_facing + rotation->get_angle()), backwards);
+            traj->time_scale = time_scale;
+            traj->transform = transform;
+            if (is_window()) {
+                // Times are reversed in the retraced turn
+                double last = moments->back().time;
+                traj->set_window(last - window_end, last - window_begin);
+            }
+            return traj;
+        }
         auto p = path->retrace();
 
+        auto &moments = *this->moments;
         std::vector<TankDriveMoment> m;
         m.reserve(moments.size());
         auto &last = moments[moments.size() - 1];
@@ -217,7 +444,49 @@ namespace rpf {
             nm.backwards = !backwards;
             m.push_back(nm);
         }
-        return std::shared_ptr<TankDriveTrajectory>(
+        auto traj = std::shared_ptr<TankDriveTrajectory>(
                 new TankDriveTrajectory(p, std::move(m), !backwards, specs, params));
+        traj->time_scale = time_scale;
+        traj->transform = transform;
+        if (is_window()) {
+            // Times are reversed in the retraced trajectory
+            traj->set_window(last.time - window_end, last.time - window_begin);
+        }
+        return traj;
+    }
+    std::shared_ptr<TankDriveTrajectory> TankDriveTrajectory::time_scaled(double factor) const {
+        if (!(factor > 0) || std::isinf(factor)) {
+            throw std::invalid_argument("Time scale factor must be positive and finite");
+        }
+        // The copy shares the moments, the path and the rotation profile
+        auto traj = std::make_shared<TankDriveTrajectory>(*this);
+        traj->time_scale *= factor;
+        return traj;
+    }
+    std::shared_ptr<TankDriveTrajectory> TankDriveTrajectory::transformed(
+            const RigidTransform &transform) const {
+        // The copy shares the moments, and its path shares the segments and the lookup table
+        // Turns in place have no path, so only their position and headings are transformed
+        auto traj = std::make_shared<TankDriveTrajectory>(*this);
+        if (path) {
+            traj->path = path->transformed(transform);
+        }
+        traj->transform = this->transform.then(transform);
+        return traj;
+    }
+    std::shared_ptr<TankDriveTrajectory> TankDriveTrajectory::subtrajectory(
+            double t0, double t1) const {
+        if (!(t0 >= 0 && t0 < t1 && t1 <= total_time())) {
+            throw std::invalid_argument(
+                    "Subtrajectory times must satisfy 0 <= t0 < t1 <= total time");
+        }
+        // The copy shares the moments, the path and the rotation profile; only the window changes
+        auto traj = std::make_shared<TankDriveTrajectory>(*this);
+        traj->set_window(source_time(t0), source_time(t1));
+        return traj;
+    }
+    std::shared_ptr<TankDriveTrajectory> TankDriveTrajectory::anchored_at(
+            const Waypoint &pose) const {
+        return transformed(RigidTransform::between(get_pos(0), pose));
     }
 } // namespace rpf
@@ -0,0 +1,116 @@
+#include "trajectory/wheellimits.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace rpf {
+
+    WheelLimits::WheelLimits(const RobotSpecs &specs, double base_radius)
+            : b(base_radius), max_v(specs.max_v), max_a(specs.max_a),
+              voltage(!std::isnan(specs.max_voltage)), max_voltage(specs.max_voltage),
+              kv(specs.kv), ka(specs.ka) {
+        // A wheel cannot go faster than the velocity at which the back EMF uses up all the voltage
+        if (voltage && kv > 0) {
+            max_v = std::min(max_v, max_voltage / kv);
+        }
+    }
+
+    void WheelLimits::accel_bounds(
+            double k, double dk, double v, double x, double &lo, double &hi) const {
+        lo = -std::numeric_limits<double>::infinity();
+        hi = std::numeric_limits<double>::infinity();
+        for (int sign = -1; sign <= 1; sign += 2) {
+            double c = 1 + sign * b * k;
+            double dc = sign * b * dk;
+            // When c is zero the wheel acceleration does not depend on a at all
+            // This is handled by the maximum velocity curve
+            if (std::abs(c) < 1e-9) {
+                continue;
+            }
+            // The range of accelerations allowed for this wheel
+            double wlo = -max_a;
+            double whi = max_a;
+            if (voltage && ka > 0) {
+                // kV * v + kA * a must be within +/- the max voltage
+                wlo = std::max(wlo, (-max_voltage - kv * c * v) / ka);
+                whi = std::min(whi, (max_voltage - kv * c * v) / ka);
+            }
+            // The wheel acceleration is c * a + dc * x
+            double l = (wlo - dc * x) / c;
+            double h = (whi - dc * x) / c;
+            if (c < 0) {
+                std::swap(l, h);
+            }
+            lo = std::max(lo, l);
+            hi = std::min(hi, h);
+        }
+    }
+
+    double WheelLimits::max_vel_sq(double k, double dk) const {
+        // The faster wheel is at the max velocity
+        double v = max_v / (1 + b * std::abs(k));
+        double x = v * v;
+
+        double c = 1 + b * std::abs(k);
+        double dc = std::abs(b * dk);
+        if (dc != 0) {
+            // At a constant velocity, the wheel accelerations are +/- x b dk/ds
+            x = std::min(x, max_a / dc);
+            if (voltage && ka > 0) {
+                // Solve kV * c * v + kA * dc * v^2 = max voltage for v
+                // This form of the quadratic formula avoids cancellation when kA * dc is small
+                double kvc = kv * c;
+                double cruise_v = 2 * max_voltage /
+                                  (kvc + std::sqrt(kvc * kvc + 4 * ka * dc * max_voltage));
+                x = std::min(x, cruise_v * cruise_v);
+            }
+        }
+        return x;
+    }
+
+    double WheelLimits::step_forward(double k0, double dk, double x0, double cap, double ds) const {
+        double lo, hi;
+        double v0 = std::sqrt(x0);
+        accel_bounds(k0, dk, v0, x0, lo, hi);
+        double x1 = std::max(std::min(x0 + 2 * hi * ds, cap), 0.0);
+
+        // The acceleration of a moment goes with the velocity at its start, so the voltage limit
+        // is still evaluated at v0
+        double v1 = std::sqrt(x1);
+        accel_bounds(k0, dk, v0, v1 * (v0 + v1) / 2, lo, hi);
+        return std::max(std::min(x1, x0 + 2 * hi * ds), 0.0);
+    }
+
+    double WheelLimits::step_backward(
+            double k0, double dk, double x1, double cap, double ds) const {
+        double lo, hi;
+        double v1 = std::sqrt(x1);
+        // The voltage limit on deceleration is the tightest at the end with the lower velocity
+        accel_bounds(k0, dk, v1, x1, lo, hi);
+        double x0 = std::max(std::min(x1 - 2 * lo * ds, cap), 0.0);
+
+        accel_bounds(k0, dk, v1, v1 * (std::sqrt(x0) + v1) / 2, lo, hi);
+        return std::max(std::min(x0, x1 - 2 * lo * ds), 0.0);
+    }
+
+    double WheelLimits::step_backward_bound(
+            double k0, double dk, double x1_lo, double x1_hi, double cap, double ds) const {
+        // step_backward() evaluates the bounds at v1 and at an x between v1^2 / 2 (when v0 is 0)
+        // and v1 (sqrt(cap) + v1) / 2
+        // For each wheel, the lower bound of the acceleration only goes one way with v and with x,
+        // so its highest value over all of them is at one of the corners
+        double v_lo = std::sqrt(x1_lo);
+        double v_hi = std::sqrt(x1_hi);
+        double x_lo = x1_lo / 2;
+        double x_hi = std::max(x1_hi, v_hi * (std::sqrt(cap) + v_hi) / 2);
+        double lo_max = -std::numeric_limits<double>::infinity();
+        for (double v : {v_lo, v_hi}) {
+            for (double x : {x_lo, x_hi}) {
+                double lo, hi;
+                accel_bounds(k0, dk, v, x, lo, hi);
+                lo_max = std::max(lo_max, lo);
+            }
+        }
+        return std::max(std::min(x1_lo - 2 * lo_max * ds, cap), 0.0);
+    }
+} // namespace rpf
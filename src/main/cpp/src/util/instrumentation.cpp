@@ -0,0 +1,197 @@
+#include "util/instrumentation.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+namespace rpf {
+
+    /*
+     * Each thread gets its own block of stats, which only it writes to. Since there is only one
+     * writer, the updates are plain relaxed loads and stores instead of read-modify-write
+     * operations. The snapshot reads every block and adds them up.
+     *
+     * The histograms are log-linear: values under 8 ns get a bucket each, and every power of 2
+     * above that is split into 8 buckets.
+     */
+
+    namespace {
+        constexpr int PROBE_COUNT = static_cast<int>(Probe::COUNT);
+        constexpr int SUB_BUCKETS = 8;
+        constexpr int BUCKETS = SUB_BUCKETS + 61 * SUB_BUCKETS;
+
+        using Counter = std::atomic<std::uint64_t>;
+
+        struct ProbeStats {
+            Counter count, total, min, max;
+            Counter buckets[BUCKETS];
+        };
+        struct ThreadStats {
+            ProbeStats probes[PROBE_COUNT];
+        };
+
+        std::mutex registry_mutex;
+        // Blocks are never freed, so that times from threads that have exited are kept
+        std::vector<std::unique_ptr<ThreadStats>> registry;
+        thread_local ThreadStats *local = nullptr;
+
+        const char *const NAMES[PROBE_COUNT] = {"path_construct", "path_compute_len", "sample",
+                "forward_pass", "backward_pass", "tank_integrate", "jni_marshal", "query"};
+
+        std::int64_t now_ns() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+        }
+
+        inline void add(Counter &c, std::uint64_t value) {
+            c.store(c.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        int bucket_of(std::uint64_t ns) {
+            if (ns < SUB_BUCKETS) {
+                return static_cast<int>(ns);
+            }
+            int exp = 0;
+            while (ns >> (exp + 1)) {
+                exp++;
+            }
+            // exp is at least 3 here, and the 3 bits below the top bit pick the sub-bucket
+            int sub = static_cast<int>((ns >> (exp - 3)) & (SUB_BUCKETS - 1));
+            return SUB_BUCKETS + (exp - 3) * SUB_BUCKETS + sub;
+        }
+        // The middle of the range of values in a bucket
+        double bucket_value(int bucket) {
+            if (bucket < SUB_BUCKETS) {
+                return bucket;
+            }
+            int exp = (bucket - SUB_BUCKETS) / SUB_BUCKETS + 3;
+            int sub = (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+            double width = std::ldexp(1.0, exp - 3);
+            return (SUB_BUCKETS + sub) * width + width / 2;
+        }
+
+        ThreadStats &local_stats() {
+            if (!local) {
+                // Value-initialize so that all the counters start at zero
+                auto stats = std::unique_ptr<ThreadStats>(new ThreadStats());
+                for (auto &p : stats->probes) {
+                    p.min.store(UINT64_MAX, std::memory_order_relaxed);
+                }
+                local = stats.get();
+                std::lock_guard<std::mutex> lock(registry_mutex);
+                registry.push_back(std::move(stats));
+            }
+            return *local;
+        }
+    } // namespace
+
+    const char *probe_name(Probe probe) {
+        return NAMES[static_cast<int>(probe)];
+    }
+
+    void record_probe(Probe probe, std::int64_t ns) {
+        std::uint64_t value = static_cast<std::uint64_t>(std::max<std::int64_t>(ns, 0));
+        ProbeStats &p = local_stats().probes[static_cast<int>(probe)];
+        add(p.count, 1);
+        add(p.total, value);
+        if (value < p.min.load(std::memory_order_relaxed)) {
+            p.min.store(value, std::memory_order_relaxed);
+        }
+        if (value > p.max.load(std::memory_order_relaxed)) {
+            p.max.store(value, std::memory_order_relaxed);
+        }
+        add(p.buckets[bucket_of(value)], 1);
+    }
+
+    std::vector<ProbeSnapshot> probe_snapshot() {
+        std::vector<ProbeSnapshot> result;
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        std::vector<std::uint64_t> buckets(BUCKETS);
+        for (int i = 0; i < PROBE_COUNT; i++) {
+            ProbeSnapshot snap;
+            snap.probe = static_cast<Probe>(i);
+            std::uint64_t total = 0, min = UINT64_MAX, max = 0;
+            std::fill(buckets.begin(), buckets.end(), 0);
+            for (const auto &stats : registry) {
+                const ProbeStats &p = stats->probes[i];
+                snap.count += p.count.load(std::memory_order_relaxed);
+                total += p.total.load(std::memory_order_relaxed);
+                min = std::min(min, p.min.load(std::memory_order_relaxed));
+                max = std::max(max, p.max.load(std::memory_order_relaxed));
+                for (int b = 0; b < BUCKETS; b++) {
+                    buckets[b] += p.buckets[b].load(std::memory_order_relaxed);
+                }
+            }
+            if (snap.count == 0) {
+                continue;
+            }
+            snap.total = total * 1e-9;
+            snap.min = min * 1e-9;
+            snap.max = max * 1e-9;
+
+            // Find the buckets that contain the percentiles
+            // The estimates are clamped to the exact min and max
+            std::uint64_t seen = 0;
+            std::uint64_t rank50 = (snap.count + 1) / 2;
+            std::uint64_t rank99 = (snap.count * 99 + 99) / 100;
+            bool found50 = false;
+            for (int b = 0; b < BUCKETS; b++) {
+                seen += buckets[b];
+                if (!found50 && seen >= rank50) {
+                    snap.p50 = std::min(std::max(bucket_value(b), double(min)), double(max)) * 1e-9;
+                    found50 = true;
+                }
+                if (seen >= rank99) {
+                    snap.p99 = std::min(std::max(bucket_value(b), double(min)), double(max)) * 1e-9;
+                    break;
+                }
+            }
+            result.push_back(snap);
+        }
+        return result;
+    }
+
+    void reset_probes() {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        for (auto &stats : registry) {
+            for (auto &p : stats->probes) {
+                p.count.store(0, std::memory_order_relaxed);
+                p.total.store(0, std::memory_order_relaxed);
+                p.min.store(UINT64_MAX, std::memory_order_relaxed);
+                p.max.store(0, std::memory_order_relaxed);
+                for (auto &b : p.buckets) {
+                    b.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    ScopedProbe::ScopedProbe(Probe probe) : probe(probe), start(now_ns()) {
+    }
+
+    void ScopedProbe::stop() {
+        if (!stopped) {
+            record_probe(probe, now_ns() - start);
+            stopped = true;
+        }
+    }
+
+    void ProbeTotal::record() {
+        if (added) {
+            record_probe(probe, total);
+            total = 0;
+            added = false;
+        }
+    }
+
+    ProbeTotal::Section::Section(ProbeTotal &total) : total(total), start(now_ns()) {
+    }
+
+    ProbeTotal::Section::~Section() {
+        total.total += now_ns() - start;
+        total.added = true;
+    }
+} // namespace rpf
@@ -0,0 +1,66 @@
+#include "util/threadpool.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace rpf {
+
+    ThreadPool::ThreadPool(std::size_t threads) {
+        if (threads == 0) {
+            throw std::invalid_argument("Thread pool must have at least one thread");
+        }
+        workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; i++) {
+            workers.emplace_back(&ThreadPool::run, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        std::deque<Task> discarded;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            discarded.swap(tasks);
+        }
+        cv.notify_all();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        // The tasks that never ran are finished off here, e.g. so that nothing waits for them
+        // forever
+        for (auto &task : discarded) {
+            if (task.discard) {
+                task.discard();
+            }
+        }
+    }
+
+    void ThreadPool::submit(std::function<void()> task, std::function<void()> discard) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(Task{std::move(task), std::move(discard)});
+        }
+        cv.notify_one();
+    }
+
+    ThreadPool &ThreadPool::shared() {
+        // hardware_concurrency() is 0 if it is not known
+        static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+        return pool;
+    }
+
+    void ThreadPool::run() {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task.run();
+        }
+    }
+} // namespace rpf
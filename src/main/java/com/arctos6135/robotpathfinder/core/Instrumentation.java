@@ -0,0 +1,113 @@
+package com.arctos6135.robotpathfinder.core;
+
+/**
+ * Timing statistics of the slow parts of the native library.
+ * <p>
+ * The native library can be built with timing probes around building paths,
+ * computing their lengths, the sampling loop and the two passes of the
+ * trajectory generators, building tank drive trajectories, converting objects
+ * between Java and C++, and looking up moments. Each thread records into its
+ * own counters, so the probes never block. Since they still add some overhead,
+ * they are only compiled in when the library is built with
+ * {@code -Pinstrumentation}; otherwise {@link #isEnabled()} returns
+ * {@code false} and {@link #snapshot()} always returns an empty array.
+ * </p>
+ * 
+ * @author Tyler Tian
+ * @since 3.0.0
+ */
+public final class Instrumentation {
+
+    static {
+        GlobalLibraryLoader.load();
+    }
+
+    private Instrumentation() {
+    }
+
+    /**
+     * The statistics of a single probe, summed across all threads. All times are
+     * in seconds.
+     * 
+     * @author Tyler Tian
+     * @since 3.0.0
+     */
+    public static class ProbeStats {
+        /**
+         * The name of the probe, e.g. {@code "forward_pass"}.
+         */
+        public final String name;
+        /**
+         * The number of times the probe was recorded.
+         */
+        public final long count;
+        /**
+         * The total time.
+         */
+        public final double total;
+        /**
+         * The shortest time.
+         */
+        public final double min;
+        /**
+         * The longest time.
+         */
+        public final double max;
+        /**
+         * The median time, estimated from a histogram.
+         */
+        public final double p50;
+        /**
+         * The 99th percentile time, estimated from a histogram.
+         */
+        public final double p99;
+
+        /**
+         * Creates a new {@link ProbeStats} object.
+         * 
+         * @param name  The name of the probe
+         * @param count The number of times the probe was recorded
+         * @param total The total time
+         * @param min   The shortest time
+         * @param max   The longest time
+         * @param p50   The median time
+         * @param p99   The 99th percentile time
+         */
+        public ProbeStats(String name, long count, double total, double min, double max, double p50,
+                double p99) {
+            this.name = name;
+            this.count = count;
+            this.total = total;
+            this.min = min;
+            this.max = max;
+            this.p50 = p50;
+            this.p99 = p99;
+        }
+
+        @Override
+        public String toString() {
+            return "{" + " name='" + name + "'" + ", count='" + count + "'" + ", total='" + total + "'"
+                    + ", min='" + min + "'" + ", max='" + max + "'" + ", p50='" + p50 + "'" + ", p99='" + p99
+                    + "'" + "}";
+        }
+    }
+
+    /**
+     * Returns whether the native library was built with the timing probes.
+     * 
+     * @return Whether the probes are enabled
+     */
+    public static native boolean isEnabled();
+
+    /**
+     * Retrieves the statistics of every probe that was recorded at least once.
+     * 
+     * @return The statistics of each probe
+     */
+    public static native ProbeStats[] snapshot();
+
+    /**
+     * Clears the statistics of all probes.
+     */
+    public static native void reset();
+}
@@ -14,6 +14,13 @@ import java.util.Objects;
  * The units used here also dictate which units are used by trajectories when
  * they return data for a specific time.
  * </p>
+ * <p>
+ * Optionally, a voltage limit can also be specified with
+ * {@link #setVoltageLimit(double, double, double)}. When set, the voltage
+ * required by each side of the robot, as predicted by the feedforward model
+ * {@code voltage = kV * velocity + kA * acceleration}, is kept under the max
+ * voltage during trajectory generation.
+ * </p>
  * 
  * @author Tyler Tian
  * @since 3.0.0
@@ -22,6 +29,8 @@ public class RobotSpecs {
 
 	protected double baseWidth = Double.NaN;
 	protected double maxVelocity, maxAcceleration;
+	protected double maxVoltage = Double.NaN;
+	protected double kV, kA;
 
 	@Override
 	public boolean equals(Object o) {
@@ -32,18 +41,21 @@ public class RobotSpecs {
 		}
 		RobotSpecs robotSpecs = (RobotSpecs) o;
 		return baseWidth == robotSpecs.baseWidth && maxVelocity == robotSpecs.maxVelocity
-				&& maxAcceleration == robotSpecs.maxAcceleration;
+				&& maxAcceleration == robotSpecs.maxAcceleration
+				&& Double.compare(maxVoltage, robotSpecs.maxVoltage) == 0 && kV == robotSpecs.kV
+				&& kA == robotSpecs.kA;
 	}
 
 	@Override
 	public int hashCode() {
-		return Objects.hash(baseWidth, maxVelocity, maxAcceleration);
+		return Objects.hash(baseWidth, maxVelocity, maxAcceleration, maxVoltage, kV, kA);
 	}
 
 	@Override
 	public String toString() {
 		return "{" + " baseWidth='" + getBaseWidth() + "'" + ", maxVelocity='" + getMaxVelocity() + "'"
-				+ ", maxAcceleration='" + getMaxAcceleration() + "'" + "}";
+				+ ", maxAcceleration='" + getMaxAcceleration() + "'" + ", maxVoltage='" + getMaxVoltage() + "'"
+				+ ", kV='" + getKV() + "'" + ", kA='" + getKA() + "'" + "}";
 	}
 
 	/**
@@ -129,4 +141,53 @@ public class RobotSpecs {
 	public void setMaxAcceleration(double maxAcceleration) {
 		this.maxAcceleration = maxAcceleration;
 	}
+
+	/**
+	 * Sets the voltage limit of this robot specifications object.
+	 * <p>
+	 * The voltage required by each side of the robot is predicted with the
+	 * feedforward model {@code voltage = kV * velocity + kA * acceleration}.
+	 * Trajectories generated with these specifications will keep it under the
+	 * max voltage. Setting the max voltage to {@code NaN} removes the limit.
+	 * </p>
+	 * 
+	 * @param maxVoltage The max voltage that can be applied to each side of the
+	 *                   robot
+	 * @param kV         The voltage required per unit of velocity
+	 * @param kA         The voltage required per unit of acceleration
+	 */
+	public void setVoltageLimit(double maxVoltage, double kV, double kA) {
+		this.maxVoltage = maxVoltage;
+		this.kV = kV;
+		this.kA = kA;
+	}
+
+	/**
+	 * Retrieves the max voltage of this robot specifications object.
+	 * 
+	 * @return The max voltage of each side of the robot, or {@code NaN} if there
+	 *         is no voltage limit
+	 */
+	public double getMaxVoltage() {
+		return maxVoltage;
+	}
+
+	/**
+	 * Retrieves the velocity feedforward gain of this robot specifications object.
+	 * 
+	 * @return The voltage required per unit of velocity
+	 */
+	public double getKV() {
+		return kV;
+	}
+
+	/**
+	 * Retrieves the acceleration feedforward gain of this robot specifications
+	 * object.
+	 * 
+	 * @return The voltage required per unit of acceleration
+	 */
+	public double getKA() {
+		return kA;
+	}
 }
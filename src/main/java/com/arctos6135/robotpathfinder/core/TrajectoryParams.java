@@ -4,6 +4,7 @@ import java.util.Arrays;
 import java.util.Objects;
 
 import com.arctos6135.robotpathfinder.core.path.PathType;
+import com.arctos6135.robotpathfinder.core.trajectory.GeneratorType;
 
 /**
  * A collection of parameters for trajectory generation. Used in the
@@ -51,6 +52,12 @@ public class TrajectoryParams implements Cloneable {
 	 * {@link PathType}. Default value is {@link PathType#QUINTIC_HERMITE}.
 	 */
 	public PathType pathType = PathType.QUINTIC_HERMITE;
+	/**
+	 * The algorithm used to generate the velocity profile of the trajectory. For
+	 * more information, see {@link GeneratorType}. Default value is
+	 * {@link GeneratorType#TWO_PASS}.
+	 */
+	public GeneratorType generatorType = GeneratorType.TWO_PASS;
 
 	/**
 	 * Creates an identical copy of this {@link TrajectoryParams}.
@@ -62,6 +69,7 @@ public class TrajectoryParams implements Cloneable {
 		tp.alpha = this.alpha;
 		tp.sampleCount = this.sampleCount;
 		tp.pathType = this.pathType;
+		tp.generatorType = this.generatorType;
 		return tp;
 	}
 
@@ -74,18 +82,18 @@ public class TrajectoryParams implements Cloneable {
 		}
 		TrajectoryParams t = (TrajectoryParams) o;
 		return Arrays.equals(waypoints, t.waypoints) && alpha == t.alpha && sampleCount == t.sampleCount
-				&& pathType == t.pathType;
+				&& pathType == t.pathType && generatorType == t.generatorType;
 	}
 
 	@Override
 	public int hashCode() {
-		return Objects.hash(waypoints, alpha, sampleCount, pathType);
+		return Objects.hash(waypoints, alpha, sampleCount, pathType, generatorType);
 	}
 
 	@Override
 	public String toString() {
 		return "{" + " waypoints='" + waypoints + "'" + ", alpha='" + alpha + "'" + ", sampleCount='" + sampleCount
-				+ "'" + ", pathType='" + pathType + "'" + "}";
+				+ "'" + ", pathType='" + pathType + "'" + ", generatorType='" + generatorType + "'" + "}";
 	}
 
 	/**
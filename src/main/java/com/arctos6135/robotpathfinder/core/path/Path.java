@@ -266,6 +266,82 @@ public class Path extends JNIObject {
      */
     public native Pair<Vec2D, Vec2D> wheelsAt(double time);
 
+    /**
+     * Retrieves the curvature at a specified time in the path. The curvature is
+     * positive when the path turns left, and negative when it turns right.
+     * <p>
+     * Note that this method does not take into account the lengths of the segments
+     * of the path. Rather it divides the total time evenly into equal sized
+     * segments for each segment, regardless of their lengths. This means that even
+     * though some segments may be longer than others, they still take up the same
+     * amount of time.
+     * </p>
+     * 
+     * @param time A real number in the range [0, 1]
+     * @return The curvature of this path at the specified time
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    public native double curvatureAt(double time);
+
+    /**
+     * Retrieves the derivative of the curvature with respect to distance at a
+     * specified time in the path.
+     * <p>
+     * Note that this method does not take into account the lengths of the segments
+     * of the path. Rather it divides the total time evenly into equal sized
+     * segments for each segment, regardless of their lengths. This means that even
+     * though some segments may be longer than others, they still take up the same
+     * amount of time.
+     * </p>
+     * 
+     * @param time A real number in the range [0, 1]
+     * @return The derivative of the curvature of this path with respect to
+     *         distance at the specified time
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    public native double curvatureDerivAt(double time);
+
+    /**
+     * Retrieves the curvature at multiple times in the path. This is equivalent to
+     * calling {@link #curvatureAt(double)} for every time, but only makes one
+     * native call.
+     * 
+     * @param times An array of real numbers in the range [0, 1]
+     * @return An array containing the curvature at each time
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    public native double[] curvaturesAt(double[] times);
+
+    /**
+     * Retrieves the derivative of the curvature with respect to distance at
+     * multiple times in the path. This is equivalent to calling
+     * {@link #curvatureDerivAt(double)} for every time, but only makes one native
+     * call.
+     * 
+     * @param times An array of real numbers in the range [0, 1]
+     * @return An array containing the derivative of the curvature at each time
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    public native double[] curvatureDerivsAt(double[] times);
+
+    /**
+     * Retrieves an upper bound on the absolute value of the curvature of the
+     * segment that contains the specified time. The bound is computed analytically
+     * when the path is created, and is guaranteed to be greater than or equal to
+     * the actual max curvature of the segment. It may be infinite if the segment
+     * could have a cusp.
+     * 
+     * @param time A real number in the range [0, 1]
+     * @return An upper bound on the absolute curvature of the segment
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    public native double curvatureBoundAt(double time);
+
     private native double _computeLen(int points);
 
     private native double _s2T(double s);
@@ -352,6 +428,8 @@ public class Path extends JNIObject {
 
     private native long _retrace();
 
+    private native long _transformed(double x, double y, double angle);
+
     /**
      * Updates the cached waypoints in this class.
      * <p>
@@ -410,4 +488,31 @@ public class Path extends JNIObject {
         p._updateWaypoints();
         return p;
     }
+
+    /**
+     * Constructs a new path, which is this path rotated counterclockwise by the
+     * specified angle about the origin and then moved by the specified amount.
+     * <p>
+     * Using this method is much faster than creating a new path, since the new
+     * path shares its segments and length lookup table with this one in native
+     * code, and only transforms the positions and derivatives it returns. Its
+     * length does not have to be computed again.
+     * </p>
+     * 
+     * @param x     The distance to move the path by in the x direction
+     * @param y     The distance to move the path by in the y direction
+     * @param angle The angle to rotate the path by, in radians
+     * @return The new path
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    public Path transformed(double x, double y, double angle) {
+        Path p = new Path(waypoints, alpha, type, _transformed(x, y, angle));
+        p.backwards = backwards;
+        p.radius = radius;
+        p.length = length;
+        p.waypoints = new Waypoint[waypoints.length];
+        p._updateWaypoints();
+        return p;
+    }
 }
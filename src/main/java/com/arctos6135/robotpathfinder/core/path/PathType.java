@@ -34,11 +34,29 @@ public enum PathType {
 	 * second derivatives constrained, these paths may have small jumps in
 	 * acceleration where two segments meet.
 	 */
-	CUBIC_HERMITE;
+	CUBIC_HERMITE,
+	/**
+	 * The path spline consists of segments of quintic hermite polynomials, like
+	 * {@link #QUINTIC_HERMITE}. However, instead of being set to zero, the second
+	 * derivatives at the waypoints are solved for so that the total jerk of the
+	 * path is minimized. This avoids the curvature spikes between waypoints of
+	 * {@link #QUINTIC_HERMITE} paths, which allows tank drive trajectories to
+	 * sustain higher speeds.
+	 */
+	QUINTIC_HERMITE_C2,
+	/**
+	 * The path consists of clothoid (Euler spiral) segments, whose curvature
+	 * changes linearly with distance. Each segment is fitted to the positions and
+	 * headings of its waypoints, so the alpha value is not used. Note that the
+	 * curvature may still jump where two segments meet.
+	 */
+	CLOTHOID;
 
 	private static final int PT_BEZIER = 1;
 	private static final int PT_CUBIC_HERMITE = 2;
 	private static final int PT_QUINTIC_HERMITE = 3;
+	private static final int PT_QUINTIC_HERMITE_C2 = 4;
+	private static final int PT_CLOTHOID = 5;
 
 	/**
 	 * Retrieves the JNI enum value of this {@link PathType}.
@@ -57,6 +75,10 @@ public enum PathType {
 			return PT_CUBIC_HERMITE;
 		case QUINTIC_HERMITE:
 			return PT_QUINTIC_HERMITE;
+		case QUINTIC_HERMITE_C2:
+			return PT_QUINTIC_HERMITE_C2;
+		case CLOTHOID:
+			return PT_CLOTHOID;
 		default:
 			return 0;
 		}
@@ -75,8 +75,8 @@ public class BasicTrajectory extends Trajectory<BasicMoment> {
         GlobalLifeCycleManager.initialize();
     }
 
-    private native void _construct(double maxV, double maxA, double baseWidth, boolean isTank, Waypoint[] waypoints,
-            double alpha, int sampleCount, int type);
+    private native void _construct(double maxV, double maxA, double baseWidth, double maxVoltage, double kV,
+            double kA, boolean isTank, Waypoint[] waypoints, double alpha, int sampleCount, int type, int generator);
 
     /**
      * Creates a new {@link BasicTrajectory} with the specified robot specifications
@@ -109,8 +109,40 @@ public class BasicTrajectory extends Trajectory<BasicMoment> {
         this.specs = specs;
         this.params = params;
 
-        _construct(specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(), false, params.waypoints,
-                params.alpha, params.sampleCount, params.pathType.getJNIID());
+        _construct(specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(), specs.getMaxVoltage(),
+                specs.getKV(), specs.getKA(), false, params.waypoints, params.alpha, params.sampleCount,
+                params.pathType.getJNIID(), params.generatorType.getJNIID());
+        GlobalLifeCycleManager.register(this);
+    }
+
+    private native void _constructSampled(SampledPath path, double maxV, double maxA, double baseWidth,
+            double maxVoltage, double kV, double kA);
+
+    /**
+     * Creates a new {@link BasicTrajectory} along a path that is already sampled.
+     * <p>
+     * This only generates the timing of the trajectory, so it is faster than
+     * generating it from the parameters when several trajectories with different
+     * specs are needed for the same path. The trajectory is exactly the same as
+     * one generated with the specs and the parameters of the path.
+     * </p>
+     * 
+     * @param specs A {@link RobotSpecs} object providing robot information such as
+     *              the maximum velocity.
+     * @param path  The sampled path
+     * @throws IllegalArgumentException      If the path was sampled for tank drive
+     *                                       with a different base width
+     * @throws TrajectoryGenerationException If the constraints set in the
+     *                                       parameters cannot be met
+     */
+    public BasicTrajectory(RobotSpecs specs, SampledPath path) {
+        path.checkSpecs(specs);
+
+        this.specs = specs;
+        this.params = path.getParams();
+
+        _constructSampled(path, specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(),
+                specs.getMaxVoltage(), specs.getKV(), specs.getKA());
         GlobalLifeCycleManager.register(this);
     }
 
@@ -125,13 +157,73 @@ public class BasicTrajectory extends Trajectory<BasicMoment> {
      * @param params The parameters of this trajectory
      * @param ptr    A pointer to the native resource
      */
-    private BasicTrajectory(RobotSpecs specs, TrajectoryParams params, long ptr) {
+    BasicTrajectory(RobotSpecs specs, TrajectoryParams params, long ptr) {
         this.specs = specs;
         this.params = params;
         _nativePtr = ptr;
         GlobalLifeCycleManager.register(this);
     }
 
+    /**
+     * Starts generating a {@link BasicTrajectory} in the background, and returns
+     * right away.
+     * <p>
+     * The trajectory is generated on a native thread pool, so that generation
+     * does not block the calling thread (e.g. the robot loop). Use the returned
+     * {@link GenerationHandle} to check on the generation and retrieve the
+     * trajectory. The arguments are the same as the ones for the constructor.
+     * </p>
+     * 
+     * @param specs  A {@link RobotSpecs} object providing robot information such as
+     *               the maximum velocity.
+     * @param params A {@link TrajectoryParams} object providing path/trajectory
+     *               information such as the waypoints.
+     * @return A handle to the trajectory being generated
+     */
+    public static GenerationHandle<BasicTrajectory> generateAsync(RobotSpecs specs, TrajectoryParams params) {
+        return new GenerationHandle<>(false, specs, params);
+    }
+
+    /**
+     * Creates an {@link IncrementalGenerator} for a {@link BasicTrajectory}.
+     * <p>
+     * The trajectory is only generated as {@link IncrementalGenerator#step(double)}
+     * is called, a bit at a time, so that it can be generated on the calling
+     * thread without blocking it for long. The arguments are the same as the ones
+     * for the constructor.
+     * </p>
+     * 
+     * @param specs  A {@link RobotSpecs} object providing robot information such as
+     *               the maximum velocity.
+     * @param params A {@link TrajectoryParams} object providing path/trajectory
+     *               information such as the waypoints.
+     * @return A generator for the trajectory
+     */
+    public static IncrementalGenerator<BasicTrajectory> generateIncremental(RobotSpecs specs, TrajectoryParams params) {
+        return new IncrementalGenerator<>(false, false, specs, params);
+    }
+
+    /**
+     * Creates a streaming {@link IncrementalGenerator} for a
+     * {@link BasicTrajectory}.
+     * <p>
+     * Like {@link #generateIncremental(RobotSpecs, TrajectoryParams)}, except
+     * that the start of the trajectory can be retrieved and followed before the
+     * rest of it is generated. See {@link IncrementalGenerator} for how the
+     * trajectory has to be used while it is being generated. The arguments are
+     * the same as the ones for the constructor.
+     * </p>
+     * 
+     * @param specs  A {@link RobotSpecs} object providing robot information such as
+     *               the maximum velocity.
+     * @param params A {@link TrajectoryParams} object providing path/trajectory
+     *               information such as the waypoints.
+     * @return A streaming generator for the trajectory
+     */
+    public static IncrementalGenerator<BasicTrajectory> generateStreaming(RobotSpecs specs, TrajectoryParams params) {
+        return new IncrementalGenerator<>(false, true, specs, params);
+    }
+
     @Override
     protected native void _destroy();
 
@@ -148,8 +240,11 @@ public class BasicTrajectory extends Trajectory<BasicMoment> {
      */
     @Override
     public BasicMoment[] getMoments() {
-        if (momentsCache == null) {
-            momentsCache = new BasicMoment[_getMomentCount()];
+        // Streaming trajectories grow as they are generated, so the cache is only used if
+        // no moments were added since it was made
+        int count = _getMomentCount();
+        if (momentsCache == null || momentsCache.length != count) {
+            momentsCache = new BasicMoment[count];
             _getMoments();
         }
         return momentsCache;
@@ -216,4 +311,44 @@ public class BasicTrajectory extends Trajectory<BasicMoment> {
         return new BasicTrajectory(specs, params, _retrace());
     }
 
+    private native long _timeScaled(double factor);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public BasicTrajectory timeScaled(double factor) {
+        return new BasicTrajectory(specs, params, _timeScaled(factor));
+    }
+
+    private native long _transformed(double x, double y, double angle);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public BasicTrajectory transformed(double x, double y, double angle) {
+        return new BasicTrajectory(specs, params, _transformed(x, y, angle));
+    }
+
+    private native long _anchoredAt(double x, double y, double heading);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public BasicTrajectory anchoredAt(Waypoint pose) {
+        return new BasicTrajectory(specs, params, _anchoredAt(pose.getX(), pose.getY(), pose.getHeading()));
+    }
+
+    private native long _subtrajectory(double t0, double t1);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public BasicTrajectory subtrajectory(double t0, double t1) {
+        return new BasicTrajectory(specs, params, _subtrajectory(t0, t1));
+    }
+
 }
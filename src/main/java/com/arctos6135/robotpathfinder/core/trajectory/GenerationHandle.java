@@ -0,0 +1,240 @@
+package com.arctos6135.robotpathfinder.core.trajectory;
+
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.CompletableFuture;
+
+import com.arctos6135.robotpathfinder.core.GlobalLibraryLoader;
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+import com.arctos6135.robotpathfinder.core.Waypoint;
+import com.arctos6135.robotpathfinder.core.lifecycle.GlobalLifeCycleManager;
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
+
+/**
+ * A handle to a trajectory that is being generated in the background.
+ * <p>
+ * Generating a trajectory can take a long time compared to the period of a
+ * robot loop. Handles are obtained from
+ * {@link BasicTrajectory#generateAsync(RobotSpecs, TrajectoryParams)} or
+ * {@link TankDriveTrajectory#generateAsync(RobotSpecs, TrajectoryParams)},
+ * which return right away while the trajectory is generated on a native thread
+ * pool. The robot loop can then poll {@link #isDone()} every iteration, or
+ * register a callback with {@link #onComplete(Runnable)}.
+ * </p>
+ * <h2>Memory Management</h2>
+ * <p>
+ * Like trajectories, handles have a native part, and {@link #free()} or
+ * {@link #close()} must be called when they are no longer needed. Freeing a
+ * handle cancels the generation if it is not finished. The trajectory
+ * returned by {@link #get()} is separate from the handle, and has to be freed
+ * separately.
+ * </p>
+ *
+ * @author Tyler Tian
+ * @param <T> The type of trajectory being generated
+ * @since 3.0.0
+ */
+public class GenerationHandle<T extends Trajectory<?>> extends JNIObject {
+
+    static {
+        GlobalLibraryLoader.load();
+        GlobalLifeCycleManager.initialize();
+    }
+
+    /**
+     * The status of a trajectory being generated.
+     *
+     * @author Tyler Tian
+     * @since 3.0.0
+     */
+    public enum Status {
+        /**
+         * The trajectory is waiting for a thread to be generated on.
+         */
+        PENDING,
+        /**
+         * The trajectory is being generated.
+         */
+        RUNNING,
+        /**
+         * The trajectory has been generated.
+         */
+        DONE,
+        /**
+         * The trajectory could not be generated.
+         */
+        FAILED,
+        /**
+         * The generation was cancelled.
+         */
+        CANCELLED;
+    }
+
+    private final boolean tank;
+    private final RobotSpecs specs;
+    private final TrajectoryParams params;
+    private T result;
+
+    private native void _construct(boolean tank, double maxV, double maxA, double baseWidth, double maxVoltage,
+            double kV, double kA, Waypoint[] waypoints, double alpha, int sampleCount, int type, int generator);
+
+    /**
+     * Starts generating a trajectory in the background.
+     *
+     * @param tank   Whether to generate a {@link TankDriveTrajectory} instead of a
+     *               {@link BasicTrajectory}
+     * @param specs  The robot specifications
+     * @param params The trajectory parameters
+     */
+    GenerationHandle(boolean tank, RobotSpecs specs, TrajectoryParams params) {
+        if (Double.isNaN(specs.getMaxVelocity())) {
+            throw new IllegalArgumentException("Max velocity cannot be NaN");
+        }
+        if (Double.isNaN(specs.getMaxAcceleration())) {
+            throw new IllegalArgumentException("Max acceleration cannot be NaN");
+        }
+        if (params.waypoints == null) {
+            throw new IllegalArgumentException("Waypoints not set");
+        }
+        if (Double.isNaN(params.alpha)) {
+            throw new IllegalArgumentException("Alpha cannot be NaN");
+        }
+        if (params.sampleCount < 1) {
+            throw new IllegalArgumentException("Segment count must be greater than zero");
+        }
+
+        this.tank = tank;
+        this.specs = specs;
+        this.params = params;
+
+        _construct(tank, specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(),
+                specs.getMaxVoltage(), specs.getKV(), specs.getKA(), params.waypoints, params.alpha,
+                params.sampleCount, params.pathType.getJNIID(), params.generatorType.getJNIID());
+        GlobalLifeCycleManager.register(this);
+    }
+
+    @Override
+    protected native void _destroy();
+
+    private native int _getStatus();
+
+    private native boolean _waitFor(double timeout);
+
+    private native long _getResult();
+
+    /**
+     * Retrieves the status of the generation.
+     *
+     * @return The status
+     */
+    public Status getStatus() {
+        return Status.values()[_getStatus()];
+    }
+
+    /**
+     * Retrieves whether the generation is finished, i.e. whether {@link #get()}
+     * will return (or throw) without blocking.
+     *
+     * @return Whether the trajectory was generated, failed or was cancelled
+     */
+    public boolean isDone() {
+        Status status = getStatus();
+        return status != Status.PENDING && status != Status.RUNNING;
+    }
+
+    /**
+     * Cancels the generation.
+     * <p>
+     * If the trajectory is already being generated, the generation stops shortly
+     * afterwards, and everything generated so far is dropped. This does not block;
+     * use {@link #await()} to wait for the generation to stop.
+     * </p>
+     *
+     * @return Whether the generation was cancelled, i.e. false if it was already
+     *         finished; if this is true, the generation always ends up
+     *         {@link Status#CANCELLED}
+     */
+    public native boolean cancel();
+
+    /**
+     * Blocks until the generation is finished.
+     */
+    public void await() {
+        _waitFor(-1);
+    }
+
+    /**
+     * Blocks until the generation is finished, or until the timeout runs out.
+     *
+     * @param timeout The maximum time to wait, in seconds
+     * @return Whether the generation finished before the timeout
+     */
+    public boolean await(double timeout) {
+        if (Double.isNaN(timeout) || timeout < 0) {
+            throw new IllegalArgumentException("Timeout must be non-negative");
+        }
+        return _waitFor(timeout);
+    }
+
+    /**
+     * Retrieves the generated trajectory, blocking until it is generated.
+     * <p>
+     * Every call returns the same object.
+     * </p>
+     *
+     * @return The generated trajectory
+     * @throws TrajectoryGenerationException If the trajectory could not be
+     *                                       generated
+     * @throws CancellationException         If the generation was cancelled
+     */
+    @SuppressWarnings("unchecked")
+    public synchronized T get() {
+        if (result == null) {
+            long ptr = _getResult();
+            if (tank) {
+                result = (T) new TankDriveTrajectory(specs, params, ptr);
+            } else {
+                result = (T) new BasicTrajectory(specs, params, ptr);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Registers a callback to be run once the generation is finished, including
+     * when it fails or is cancelled.
+     * <p>
+     * The callback is run on the native thread that generated the trajectory, so
+     * it should not block for long. If the generation is already finished, it is
+     * run right away on this thread.
+     * </p>
+     *
+     * @param callback The callback
+     */
+    public native void onComplete(Runnable callback);
+
+    /**
+     * Creates a {@link CompletableFuture} that completes with the generated
+     * trajectory.
+     * <p>
+     * The future is cancelled if the generation is cancelled, and completes
+     * exceptionally if the trajectory could not be generated. Cancelling the
+     * future does not cancel the generation.
+     * </p>
+     *
+     * @return A future for the trajectory
+     */
+    public CompletableFuture<T> toFuture() {
+        CompletableFuture<T> future = new CompletableFuture<>();
+        onComplete(() -> {
+            try {
+                future.complete(get());
+            } catch (CancellationException e) {
+                future.cancel(false);
+            } catch (RuntimeException e) {
+                future.completeExceptionally(e);
+            }
+        });
+        return future;
+    }
+}
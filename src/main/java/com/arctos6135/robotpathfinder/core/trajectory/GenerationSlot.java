@@ -0,0 +1,85 @@
+package com.arctos6135.robotpathfinder.core.trajectory;
+
+import java.util.function.BiFunction;
+
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+
+/**
+ * Holds the latest of a series of trajectories being generated in the
+ * background.
+ * <p>
+ * This is meant for things like path editors, which regenerate a trajectory
+ * every time it is changed. Most of those trajectories would be out of date by
+ * the time they are generated, so submitting a new one to the slot cancels and
+ * frees the one that came before it, even if it is already being generated.
+ * For example:
+ * </p>
+ *
+ * <pre>
+ * GenerationSlot&lt;TankDriveTrajectory&gt; slot = new GenerationSlot&lt;&gt;(TankDriveTrajectory::generateAsync);
+ * // Every time the path is changed
+ * slot.submit(specs, params).onComplete(() -&gt; redraw());
+ * </pre>
+ * <p>
+ * The slot owns the handles it creates, so they should not be freed directly.
+ * The trajectories retrieved from them have to be freed as usual.
+ * </p>
+ *
+ * @author Tyler Tian
+ * @param <T> The type of trajectory being generated
+ * @since 3.0.0
+ */
+public class GenerationSlot<T extends Trajectory<?>> implements AutoCloseable {
+
+    private final BiFunction<RobotSpecs, TrajectoryParams, GenerationHandle<T>> generator;
+    private GenerationHandle<T> current;
+
+    /**
+     * Creates a new, empty {@link GenerationSlot}.
+     *
+     * @param generator The method that starts generating a trajectory, e.g.
+     *                  {@code TankDriveTrajectory::generateAsync}
+     */
+    public GenerationSlot(BiFunction<RobotSpecs, TrajectoryParams, GenerationHandle<T>> generator) {
+        this.generator = generator;
+    }
+
+    /**
+     * Starts generating a new trajectory, and cancels the one that was submitted
+     * before it.
+     *
+     * @param specs  The robot specifications
+     * @param params The trajectory parameters
+     * @return A handle to the new trajectory
+     */
+    public synchronized GenerationHandle<T> submit(RobotSpecs specs, TrajectoryParams params) {
+        GenerationHandle<T> next = generator.apply(specs, params);
+        if (current != null) {
+            // Freeing the handle cancels the generation
+            current.free();
+        }
+        current = next;
+        return next;
+    }
+
+    /**
+     * Retrieves the handle to the trajectory that was submitted last.
+     *
+     * @return The handle, or null if nothing was submitted
+     */
+    public synchronized GenerationHandle<T> current() {
+        return current;
+    }
+
+    /**
+     * Cancels and frees the trajectory that was submitted last.
+     */
+    @Override
+    public synchronized void close() {
+        if (current != null) {
+            current.free();
+            current = null;
+        }
+    }
+}
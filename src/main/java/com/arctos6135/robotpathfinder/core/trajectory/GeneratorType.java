@@ -0,0 +1,53 @@
+package com.arctos6135.robotpathfinder.core.trajectory;
+
+/**
+ * An enum of the different algorithms that can be used to generate the velocity
+ * profile of a trajectory. See the Javadoc for the values for more information.
+ * 
+ * @author Tyler Tian
+ * @since 3.0.0
+ */
+public enum GeneratorType {
+	/**
+	 * The velocity profile is generated with a forward pass and a backward pass,
+	 * based on the algorithm shown by Team 254 (The Cheesy Poofs). For tank drive
+	 * trajectories, the max velocity, max acceleration and voltage limit (if any)
+	 * are applied to each wheel individually during both passes, so the wheels do
+	 * not exceed the limits in turns. This is the default for
+	 * {@link com.arctos6135.robotpathfinder.core.TrajectoryParams
+	 * TrajectoryParams}.
+	 */
+	TWO_PASS,
+	/**
+	 * Generates exactly the same velocity profile as {@link #TWO_PASS}. The
+	 * forward and backward passes already accelerate and decelerate as much as the
+	 * per-wheel limits allow at each sample, taking into account the change in
+	 * curvature of the path, so there is no separate time-optimal algorithm. Like
+	 * any profile generated from samples, it is only as close to the fastest
+	 * possible one as the sample count allows.
+	 */
+	TIME_OPTIMAL;
+
+	private static final int GT_TWO_PASS = 1;
+	private static final int GT_TIME_OPTIMAL = 2;
+
+	/**
+	 * Retrieves the JNI enum value of this {@link GeneratorType}.
+	 * <p>
+	 * <b><em>This method is intended for internal use only. Use at your own
+	 * risk.</em></b>
+	 * </p>
+	 * 
+	 * @return The native enum value for this {@link GeneratorType}
+	 */
+	public int getJNIID() {
+		switch (this) {
+		case TWO_PASS:
+			return GT_TWO_PASS;
+		case TIME_OPTIMAL:
+			return GT_TIME_OPTIMAL;
+		default:
+			return 0;
+		}
+	}
+}
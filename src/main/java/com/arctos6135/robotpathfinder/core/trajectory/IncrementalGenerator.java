@@ -0,0 +1,246 @@
+package com.arctos6135.robotpathfinder.core.trajectory;
+
+import com.arctos6135.robotpathfinder.core.GlobalLibraryLoader;
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+import com.arctos6135.robotpathfinder.core.Waypoint;
+import com.arctos6135.robotpathfinder.core.lifecycle.GlobalLifeCycleManager;
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
+
+/**
+ * Generates a trajectory a little at a time.
+ * <p>
+ * Unlike {@link GenerationHandle}, this does not use any other threads. The
+ * trajectory is only generated when {@link #step(double)} is called, and each
+ * call stops once the time budget given to it is used up. This makes it
+ * possible to generate a trajectory on the main robot thread without missing a
+ * loop period, by calling {@link #step(double)} once every iteration:
+ * </p>
+ *
+ * <pre>
+ * // In the periodic method
+ * if (generator.step(0.002)) {
+ *     TankDriveTrajectory trajectory = generator.get();
+ *     // ...
+ * }
+ * </pre>
+ * <p>
+ * Generators are obtained from
+ * {@link BasicTrajectory#generateIncremental(RobotSpecs, TrajectoryParams)} or
+ * {@link TankDriveTrajectory#generateIncremental(RobotSpecs, TrajectoryParams)}.
+ * A generator should only be used by one thread at a time.
+ * </p>
+ * <h2>Streaming</h2>
+ * <p>
+ * Generators obtained from
+ * {@link BasicTrajectory#generateStreaming(RobotSpecs, TrajectoryParams)} or
+ * {@link TankDriveTrajectory#generateStreaming(RobotSpecs, TrajectoryParams)}
+ * make the start of the trajectory available before the rest of it is done.
+ * Once the path has been measured, each step finishes the moments that later
+ * parts of the path can no longer change, and {@link #get()} can be called as
+ * soon as there are any. The trajectory it returns grows as the generator
+ * steps, and {@link #getAvailableTime()} is the time up to which it is final.
+ * A follower can start right away, as long as it stays behind that time:
+ * </p>
+ *
+ * <pre>
+ * // In the periodic method
+ * generator.step(0.002);
+ * if (generator.getAvailableCount() &gt; 0) {
+ *     TankDriveTrajectory trajectory = generator.get();
+ *     // Only follow up to generator.getAvailableTime()
+ * }
+ * </pre>
+ * <p>
+ * {@link Trajectory#getMoments()} retrieves the moments again whenever more
+ * have been added since the last call, so it always returns every available
+ * moment. The trajectory must not be used on one thread while the generator is
+ * stepping on another.
+ * </p>
+ * <h2>Memory Management</h2>
+ * <p>
+ * Generators have a native part, and {@link #free()} or {@link #close()} must
+ * be called when they are no longer needed. The trajectory returned by
+ * {@link #get()} is separate from the generator, and has to be freed
+ * separately.
+ * </p>
+ *
+ * @author Tyler Tian
+ * @param <T> The type of trajectory being generated
+ * @since 3.0.0
+ */
+public class IncrementalGenerator<T extends Trajectory<?>> extends JNIObject {
+
+    static {
+        GlobalLibraryLoader.load();
+        GlobalLifeCycleManager.initialize();
+    }
+
+    private final boolean tank;
+    private final boolean streaming;
+    private final RobotSpecs specs;
+    private final TrajectoryParams params;
+    private T result;
+
+    private native void _construct(boolean tank, boolean streaming, double maxV, double maxA, double baseWidth, double maxVoltage,
+            double kV, double kA, Waypoint[] waypoints, double alpha, int sampleCount, int type, int generator);
+
+    /**
+     * Creates a new generator. Nothing is generated until
+     * {@link #step(double)} is called.
+     *
+     * @param tank      Whether to generate a {@link TankDriveTrajectory} instead
+     *                  of a {@link BasicTrajectory}
+     * @param streaming Whether to make moments available before the trajectory
+     *                  is done
+     * @param specs     The robot specifications
+     * @param params    The trajectory parameters
+     */
+    IncrementalGenerator(boolean tank, boolean streaming, RobotSpecs specs, TrajectoryParams params) {
+        if (Double.isNaN(specs.getMaxVelocity())) {
+            throw new IllegalArgumentException("Max velocity cannot be NaN");
+        }
+        if (Double.isNaN(specs.getMaxAcceleration())) {
+            throw new IllegalArgumentException("Max acceleration cannot be NaN");
+        }
+        if (params.waypoints == null) {
+            throw new IllegalArgumentException("Waypoints not set");
+        }
+        if (Double.isNaN(params.alpha)) {
+            throw new IllegalArgumentException("Alpha cannot be NaN");
+        }
+        if (params.sampleCount < 1) {
+            throw new IllegalArgumentException("Segment count must be greater than zero");
+        }
+
+        this.tank = tank;
+        this.streaming = streaming;
+        this.specs = specs;
+        this.params = params;
+
+        _construct(tank, streaming, specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(),
+                specs.getMaxVoltage(), specs.getKV(), specs.getKA(), params.waypoints, params.alpha,
+                params.sampleCount, params.pathType.getJNIID(), params.generatorType.getJNIID());
+        GlobalLifeCycleManager.register(this);
+    }
+
+    @Override
+    protected native void _destroy();
+
+    private native boolean _step(double budgetUs);
+
+    private native long _getResult();
+
+    /**
+     * Generates the trajectory until the time budget is used up or the trajectory
+     * is done.
+     * <p>
+     * The budget is only checked every few hundred samples, so it can be overrun
+     * by a small amount. Every call makes at least some progress, even if the
+     * budget is zero. Once the trajectory is done, this does nothing and returns
+     * true, including after {@link #get()} was called, so it can keep being
+     * called every iteration of a loop.
+     * </p>
+     *
+     * @param budget The time budget, in seconds
+     * @return Whether the trajectory is done
+     * @throws TrajectoryGenerationException If the trajectory could not be
+     *                                       generated (and on every call after
+     *                                       that)
+     */
+    public boolean step(double budget) {
+        if (Double.isNaN(budget) || budget < 0) {
+            throw new IllegalArgumentException("Budget must be non-negative");
+        }
+        // The native trajectory was taken by get(), so there is nothing left to generate
+        if (result != null && !streaming) {
+            return true;
+        }
+        return _step(budget * 1e6);
+    }
+
+    /**
+     * Retrieves roughly how much of the trajectory has been generated.
+     * <p>
+     * This is the fraction of the samples that has been processed, summed over
+     * every stage of generation, so it is not exactly proportional to time.
+     * </p>
+     *
+     * @return The progress, from 0 to 1
+     */
+    public native double getProgress();
+
+    /**
+     * Retrieves whether the trajectory is done, i.e. whether {@link #get()} can be
+     * called.
+     *
+     * @return Whether the trajectory is done
+     */
+    public native boolean isDone();
+
+    /**
+     * Retrieves whether this generator makes moments available before the
+     * trajectory is done.
+     *
+     * @return Whether this generator is streaming
+     */
+    public boolean isStreaming() {
+        return streaming;
+    }
+
+    /**
+     * Retrieves how many moments of the trajectory are final.
+     * <p>
+     * For generators that are not streaming, this is 0 until the trajectory is
+     * done.
+     * </p>
+     *
+     * @return The number of moments available
+     */
+    public native int getAvailableCount();
+
+    /**
+     * Retrieves the time up to which the trajectory is final.
+     * <p>
+     * For generators that are not streaming, this is 0 until the trajectory is
+     * done.
+     * </p>
+     *
+     * @return The time of the last moment available
+     */
+    public native double getAvailableTime();
+
+    /**
+     * Retrieves the generated trajectory.
+     * <p>
+     * Every call returns the same object. If the generator is streaming, this
+     * can be called once any moments are available, and the trajectory keeps
+     * growing until it is done. Its {@link Trajectory#getMoments()} always
+     * includes the moments added since the last call.
+     * </p>
+     *
+     * @return The generated trajectory
+     * @throws IllegalStateException If the trajectory is not done yet, or for
+     *                               streaming generators, if no moments are
+     *                               available yet
+     */
+    @SuppressWarnings("unchecked")
+    public T get() {
+        if (result == null) {
+            if (streaming) {
+                if (getAvailableCount() == 0) {
+                    throw new IllegalStateException("No moments are available yet");
+                }
+            } else if (!isDone()) {
+                throw new IllegalStateException("The trajectory is not done yet");
+            }
+            long ptr = _getResult();
+            if (tank) {
+                result = (T) new TankDriveTrajectory(specs, params, ptr);
+            } else {
+                result = (T) new BasicTrajectory(specs, params, ptr);
+            }
+        }
+        return result;
+    }
+}
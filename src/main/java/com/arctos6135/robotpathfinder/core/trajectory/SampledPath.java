@@ -0,0 +1,158 @@
+package com.arctos6135.robotpathfinder.core.trajectory;
+
+import com.arctos6135.robotpathfinder.core.GlobalLibraryLoader;
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+import com.arctos6135.robotpathfinder.core.Waypoint;
+import com.arctos6135.robotpathfinder.core.lifecycle.GlobalLifeCycleManager;
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
+
+/**
+ * The geometry of a path, sampled once so that it can be used to generate
+ * trajectories for several different {@link RobotSpecs}.
+ * <p>
+ * Generating a trajectory is done in two parts: measuring and sampling the path
+ * (positions, headings and curvatures), and finding out how fast the robot can
+ * go along it. Only the second part depends on the robot specs, so when the
+ * same path is needed with different speeds (e.g. a slow and a fast version,
+ * or a version for a low battery), the first part can be done once here and
+ * shared:
+ * </p>
+ *
+ * <pre>
+ * SampledPath path = new SampledPath(params, baseWidth);
+ * TankDriveTrajectory slow = new TankDriveTrajectory(slowSpecs, path);
+ * TankDriveTrajectory fast = new TankDriveTrajectory(fastSpecs, path);
+ * </pre>
+ * <p>
+ * The trajectories are exactly the same as the ones generated from the specs
+ * and parameters directly. A path sampled for tank drive takes the base width
+ * of the robot into account, so it can only be used with specs that have the
+ * same base width.
+ * </p>
+ * <h2>Memory Management</h2>
+ * <p>
+ * Sampled paths have a native part, and {@link #free()} or {@link #close()}
+ * must be called when they are no longer needed. Trajectories generated from a
+ * sampled path can still be used after it is freed.
+ * </p>
+ *
+ * @author Tyler Tian
+ * @since 3.0.0
+ */
+public class SampledPath extends JNIObject {
+
+    static {
+        GlobalLibraryLoader.load();
+        GlobalLifeCycleManager.initialize();
+    }
+
+    private final TrajectoryParams params;
+    private final boolean tank;
+    private final double baseWidth;
+
+    private native void _construct(Waypoint[] waypoints, double alpha, int sampleCount, int type, int generator,
+            boolean isTank, double baseWidth);
+
+    /**
+     * Samples a path for {@link BasicTrajectory} objects.
+     *
+     * @param params A {@link TrajectoryParams} object providing path/trajectory
+     *               information such as the waypoints.
+     */
+    public SampledPath(TrajectoryParams params) {
+        this(params, false, 0);
+    }
+
+    /**
+     * Samples a path for {@link TankDriveTrajectory} objects.
+     *
+     * @param params    A {@link TrajectoryParams} object providing
+     *                  path/trajectory information such as the waypoints.
+     * @param baseWidth The base width of the robot, which has to be the same as
+     *                  the one of the specs the trajectories are generated with
+     */
+    public SampledPath(TrajectoryParams params, double baseWidth) {
+        this(params, true, baseWidth);
+    }
+
+    private SampledPath(TrajectoryParams params, boolean tank, double baseWidth) {
+        if (params.waypoints == null) {
+            throw new IllegalArgumentException("Waypoints not set");
+        }
+        if (Double.isNaN(params.alpha)) {
+            throw new IllegalArgumentException("Alpha cannot be NaN");
+        }
+        if (params.sampleCount < 1) {
+            throw new IllegalArgumentException("Segment count must be greater than zero");
+        }
+        if (Double.isNaN(baseWidth)) {
+            throw new IllegalArgumentException("Base width cannot be NaN");
+        }
+
+        this.params = params;
+        this.tank = tank;
+        this.baseWidth = baseWidth;
+
+        _construct(params.waypoints, params.alpha, params.sampleCount, params.pathType.getJNIID(),
+                params.generatorType.getJNIID(), tank, baseWidth);
+        GlobalLifeCycleManager.register(this);
+    }
+
+    @Override
+    protected native void _destroy();
+
+    /**
+     * Retrieves the length of the path.
+     *
+     * @return The length of the path
+     */
+    public native double getLength();
+
+    /**
+     * Retrieves the parameters the path was sampled with. Trajectories generated
+     * from this path use these parameters.
+     *
+     * @return The parameters
+     */
+    public TrajectoryParams getParams() {
+        return params;
+    }
+
+    /**
+     * Retrieves whether the path was sampled for {@link TankDriveTrajectory}
+     * objects.
+     *
+     * @return Whether the path is for tank drive
+     */
+    public boolean isTank() {
+        return tank;
+    }
+
+    /**
+     * Retrieves the base width the path was sampled with, or 0 if it is not for
+     * tank drive.
+     *
+     * @return The base width
+     */
+    public double getBaseWidth() {
+        return baseWidth;
+    }
+
+    /**
+     * Checks that trajectories can be generated from this path with the specs.
+     *
+     * @param specs The robot specs
+     */
+    void checkSpecs(RobotSpecs specs) {
+        if (Double.isNaN(specs.getMaxVelocity())) {
+            throw new IllegalArgumentException("Max velocity cannot be NaN");
+        }
+        if (Double.isNaN(specs.getMaxAcceleration())) {
+            throw new IllegalArgumentException("Max acceleration cannot be NaN");
+        }
+        if (tank && specs.getBaseWidth() != baseWidth) {
+            throw new IllegalArgumentException("Base width must be the same as the sampled path's");
+        }
+    }
+}
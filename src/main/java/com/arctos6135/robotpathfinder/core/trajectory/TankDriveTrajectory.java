@@ -67,8 +67,8 @@ public class TankDriveTrajectory extends Trajectory<TankDriveMoment> {
         GlobalLifeCycleManager.initialize();
     }
 
-    private native void _construct(double maxV, double maxA, double baseWidth, boolean isTank, Waypoint[] waypoints,
-            double alpha, int sampleCount, int type);
+    private native void _construct(double maxV, double maxA, double baseWidth, double maxVoltage, double kV,
+            double kA, boolean isTank, Waypoint[] waypoints, double alpha, int sampleCount, int type, int generator);
 
     /**
      * Creates a new {@link TankDriveTrajectory} with the specified robot
@@ -101,8 +101,43 @@ public class TankDriveTrajectory extends Trajectory<TankDriveMoment> {
         this.specs = specs;
         this.params = params;
 
-        _construct(specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(), true, params.waypoints,
-                params.alpha, params.sampleCount, params.pathType.getJNIID());
+        _construct(specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(), specs.getMaxVoltage(),
+                specs.getKV(), specs.getKA(), true, params.waypoints, params.alpha, params.sampleCount,
+                params.pathType.getJNIID(), params.generatorType.getJNIID());
+        GlobalLifeCycleManager.register(this);
+    }
+
+    private native void _constructSampled(SampledPath path, double maxV, double maxA, double baseWidth,
+            double maxVoltage, double kV, double kA);
+
+    /**
+     * Creates a new {@link TankDriveTrajectory} along a path that is already sampled.
+     * <p>
+     * This only generates the timing of the trajectory, so it is faster than
+     * generating it from the parameters when several trajectories with different
+     * specs are needed for the same path. The trajectory is exactly the same as
+     * one generated with the specs and the parameters of the path.
+     * </p>
+     * 
+     * @param specs A {@link RobotSpecs} object providing robot information such as
+     *              the maximum velocity.
+     * @param path  The sampled path
+     * @throws IllegalArgumentException      If the path was not sampled for tank
+     *                                       drive, or with a different base width
+     * @throws TrajectoryGenerationException If the constraints set in the
+     *                                       parameters cannot be met
+     */
+    public TankDriveTrajectory(RobotSpecs specs, SampledPath path) {
+        if (!path.isTank()) {
+            throw new IllegalArgumentException("The path must be sampled for tank drive");
+        }
+        path.checkSpecs(specs);
+
+        this.specs = specs;
+        this.params = path.getParams();
+
+        _constructSampled(path, specs.getMaxVelocity(), specs.getMaxAcceleration(), specs.getBaseWidth(),
+                specs.getMaxVoltage(), specs.getKV(), specs.getKA());
         GlobalLifeCycleManager.register(this);
     }
 
@@ -117,13 +152,73 @@ public class TankDriveTrajectory extends Trajectory<TankDriveMoment> {
      * @param params The parameters of this trajectory
      * @param ptr    A pointer to the native resource
      */
-    private TankDriveTrajectory(RobotSpecs specs, TrajectoryParams params, long ptr) {
+    TankDriveTrajectory(RobotSpecs specs, TrajectoryParams params, long ptr) {
         this.specs = specs;
         this.params = params;
         _nativePtr = ptr;
         GlobalLifeCycleManager.register(this);
     }
 
+    /**
+     * Starts generating a {@link TankDriveTrajectory} in the background, and returns
+     * right away.
+     * <p>
+     * The trajectory is generated on a native thread pool, so that generation
+     * does not block the calling thread (e.g. the robot loop). Use the returned
+     * {@link GenerationHandle} to check on the generation and retrieve the
+     * trajectory. The arguments are the same as the ones for the constructor.
+     * </p>
+     * 
+     * @param specs  A {@link RobotSpecs} object providing robot information such as
+     *               the maximum velocity.
+     * @param params A {@link TrajectoryParams} object providing path/trajectory
+     *               information such as the waypoints.
+     * @return A handle to the trajectory being generated
+     */
+    public static GenerationHandle<TankDriveTrajectory> generateAsync(RobotSpecs specs, TrajectoryParams params) {
+        return new GenerationHandle<>(true, specs, params);
+    }
+
+    /**
+     * Creates an {@link IncrementalGenerator} for a {@link TankDriveTrajectory}.
+     * <p>
+     * The trajectory is only generated as {@link IncrementalGenerator#step(double)}
+     * is called, a bit at a time, so that it can be generated on the calling
+     * thread without blocking it for long. The arguments are the same as the ones
+     * for the constructor.
+     * </p>
+     * 
+     * @param specs  A {@link RobotSpecs} object providing robot information such as
+     *               the maximum velocity.
+     * @param params A {@link TrajectoryParams} object providing path/trajectory
+     *               information such as the waypoints.
+     * @return A generator for the trajectory
+     */
+    public static IncrementalGenerator<TankDriveTrajectory> generateIncremental(RobotSpecs specs, TrajectoryParams params) {
+        return new IncrementalGenerator<>(true, false, specs, params);
+    }
+
+    /**
+     * Creates a streaming {@link IncrementalGenerator} for a
+     * {@link TankDriveTrajectory}.
+     * <p>
+     * Like {@link #generateIncremental(RobotSpecs, TrajectoryParams)}, except
+     * that the start of the trajectory can be retrieved and followed before the
+     * rest of it is generated. See {@link IncrementalGenerator} for how the
+     * trajectory has to be used while it is being generated. The arguments are
+     * the same as the ones for the constructor.
+     * </p>
+     * 
+     * @param specs  A {@link RobotSpecs} object providing robot information such as
+     *               the maximum velocity.
+     * @param params A {@link TrajectoryParams} object providing path/trajectory
+     *               information such as the waypoints.
+     * @return A streaming generator for the trajectory
+     */
+    public static IncrementalGenerator<TankDriveTrajectory> generateStreaming(RobotSpecs specs, TrajectoryParams params) {
+        return new IncrementalGenerator<>(true, true, specs, params);
+    }
+
     @Override
     protected native void _destroy();
 
@@ -140,8 +235,11 @@ public class TankDriveTrajectory extends Trajectory<TankDriveMoment> {
      */
     @Override
     public TankDriveMoment[] getMoments() {
-        if (momentsCache == null) {
-            momentsCache = new TankDriveMoment[_getMomentCount()];
+        // Streaming trajectories grow as they are generated, so the cache is only used if
+        // no moments were added since it was made
+        int count = _getMomentCount();
+        if (momentsCache == null || momentsCache.length != count) {
+            momentsCache = new TankDriveMoment[count];
             _getMoments();
         }
         return momentsCache;
@@ -207,4 +305,44 @@ public class TankDriveTrajectory extends Trajectory<TankDriveMoment> {
     public TankDriveTrajectory retrace() {
         return new TankDriveTrajectory(specs, params, _retrace());
     }
+
+    private native long _timeScaled(double factor);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public TankDriveTrajectory timeScaled(double factor) {
+        return new TankDriveTrajectory(specs, params, _timeScaled(factor));
+    }
+
+    private native long _transformed(double x, double y, double angle);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public TankDriveTrajectory transformed(double x, double y, double angle) {
+        return new TankDriveTrajectory(specs, params, _transformed(x, y, angle));
+    }
+
+    private native long _anchoredAt(double x, double y, double heading);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public TankDriveTrajectory anchoredAt(Waypoint pose) {
+        return new TankDriveTrajectory(specs, params, _anchoredAt(pose.getX(), pose.getY(), pose.getHeading()));
+    }
+
+    private native long _subtrajectory(double t0, double t1);
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public TankDriveTrajectory subtrajectory(double t0, double t1) {
+        return new TankDriveTrajectory(specs, params, _subtrajectory(t0, t1));
+    }
 }
@@ -101,7 +101,9 @@ public abstract class Trajectory<T extends Moment> extends JNIObject implements
      * Because the moments have to be retrieved from a native object, when this
      * method is first called, the moments are retrieved and cached so that future
      * calls to this method will be faster. To free the cache and reclaim the
-     * memory, use {@link #clearMomentsCache()}.
+     * memory, use {@link #clearMomentsCache()}. If moments were added to the
+     * trajectory since then, as with the trajectory of a streaming
+     * {@link IncrementalGenerator}, they are retrieved again.
      * </p>
      * 
      * @return An array of {@link Moment}s generated by this trajectory
@@ -172,10 +174,13 @@ public abstract class Trajectory<T extends Moment> extends JNIObject implements
      * 
      * @return The {@link Path} followed by this trajectory
      * @throws IllegalStateException If the native resource has already been freed
-     *                               (see class Javadoc)
+     *                               (see class Javadoc), or if the trajectory
+     *                               does not have a path (e.g. turns in place)
      */
     public Path getPath() {
-        Path path = new Path(params.waypoints, params.alpha, params.pathType, _getPath());
+        // Trajectories without a path have no params either, so this has to throw first
+        long ptr = _getPath();
+        Path path = new Path(params.waypoints, params.alpha, params.pathType, ptr);
         path.setBaseRadius(specs.getBaseWidth() / 2);
         path._updateWaypoints();
         return path;
@@ -277,4 +282,101 @@ public abstract class Trajectory<T extends Moment> extends JNIObject implements
      *                               (see class Javadoc)
      */
     abstract public Trajectory<T> retrace();
+
+    /**
+     * Creates a new {@link Trajectory} which is the same as this one, but slower
+     * by the specified factor. Times are multiplied by the factor, velocities are
+     * divided by it and accelerations are divided by its square, while the path
+     * stays the same. For example, {@code timeScaled(1 / 0.7)} drives the
+     * trajectory at 70% speed.
+     * <p>
+     * Using this method is much faster than creating a new trajectory, since
+     * nothing is generated again: the new trajectory shares its moments with this
+     * one in native code, and scales them as they are retrieved. It is not checked
+     * against the {@link RobotSpecs}, so a factor less than 1 can make it go over
+     * the limits of the robot.
+     * </p>
+     * <p>
+     * Note that the trajectory generated by this method will carry the same
+     * {@link RobotSpecs} and {@link TrajectoryParams} as original trajectory.
+     * </p>
+     * 
+     * @param factor How many times slower the new trajectory is; must be positive
+     *               and finite
+     * @return The new trajectory
+     * @throws IllegalArgumentException If the factor is not positive and finite
+     * @throws IllegalStateException    If the native resource has already been
+     *                                  freed (see class Javadoc)
+     */
+    abstract public Trajectory<T> timeScaled(double factor);
+
+    /**
+     * Creates a new {@link Trajectory} which is this trajectory rotated
+     * counterclockwise by the specified angle about the origin and then moved by
+     * the specified amount.
+     * <p>
+     * Using this method is much faster than creating a new trajectory, since
+     * nothing is generated again: the new trajectory shares its moments and path
+     * with this one in native code, and only transforms the positions and
+     * headings it returns. Distances, velocities and timing are all unchanged.
+     * </p>
+     * <p>
+     * Note that the trajectory generated by this method will carry the same
+     * {@link RobotSpecs} and {@link TrajectoryParams} as original trajectory (e.g.
+     * The change in waypoints is not reflected in the new trajectory's
+     * {@link TrajectoryParams}).
+     * </p>
+     * 
+     * @param x     The distance to move the trajectory by in the x direction
+     * @param y     The distance to move the trajectory by in the y direction
+     * @param angle The angle to rotate the trajectory by, in radians
+     * @return The new trajectory
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    abstract public Trajectory<T> transformed(double x, double y, double angle);
+
+    /**
+     * Creates a new {@link Trajectory} which is this trajectory moved so that it
+     * starts at the specified pose, i.e. {@code getPosition(0)} of the new
+     * trajectory is the pose.
+     * <p>
+     * This is useful for trajectories that are generated ahead of time, which can
+     * then be moved to wherever the robot actually is before following them. Like
+     * {@link #transformed(double, double, double)}, nothing is generated again.
+     * </p>
+     * 
+     * @param pose The position and heading the new trajectory starts at
+     * @return The new trajectory
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
+     */
+    abstract public Trajectory<T> anchoredAt(Waypoint pose);
+
+    /**
+     * Creates a new {@link Trajectory} which is the part of this trajectory
+     * between the specified times. The new trajectory starts at time 0 and
+     * distance 0, so it can be followed on its own; its first and last moments are
+     * the moments of this trajectory at {@code t0} and {@code t1}.
+     * <p>
+     * Using this method is much faster than creating a new trajectory, since
+     * nothing is generated or copied: the new trajectory shares its moments and
+     * path with this one in native code, and only shifts the times and distances
+     * it returns. Subtrajectories can be scaled, transformed, mirrored and
+     * retraced like any other trajectory.
+     * </p>
+     * <p>
+     * Note that the trajectory generated by this method will carry the same
+     * {@link RobotSpecs} and {@link TrajectoryParams} as original trajectory.
+     * </p>
+     * 
+     * @param t0 The time in this trajectory where the new trajectory starts
+     * @param t1 The time in this trajectory where the new trajectory ends
+     * @return The part of this trajectory between the times
+     * @throws IllegalArgumentException If the times do not satisfy
+     *                                  {@code 0 <= t0 < t1 <= totalTime()}
+     * @throws IllegalStateException    If the native resource has already been
+     *                                  freed (see class Javadoc)
+     */
+    abstract public Trajectory<T> subtrajectory(double t0, double t1);
 }
@@ -91,6 +91,11 @@ final public class TrajectoryGenerator {
 	 * <em> Note: Trajectories generated by this method will have their
 	 * {@link RobotSpecs} and {@link TrajectoryParams} set to {@code null}. </em>
 	 * </p>
+	 * <p>
+	 * The turn is computed directly from trapezoidal profiles for both wheels,
+	 * without generating a path. As a result, these trajectories do not have a
+	 * path, and their moments only contain the start and the end of the turn.
+	 * </p>
 	 * 
 	 * @deprecated Use a {@link TrapezoidalTankDriveRotationProfile} instead.
 	 * @param specs The specifications of the robot
@@ -504,7 +504,7 @@ public class DynamicTankDriveFollower extends DynamicFollower<TankDriveMoment> {
 		// Calculate outputs
 		leftOutput = kA * m.getLeftAcceleration() + kV * m.getLeftVelocity() + kP * leftErr + kI * lErrorInt
 				+ kD * leftDeriv - dirErr * kDP;
-		rightOutput = kA * m.getRightAcceleration() + kV * m.getRightVelocity() + kP * rightErr + kI * lErrorInt
+		rightOutput = kA * m.getRightAcceleration() + kV * m.getRightVelocity() + kP * rightErr + kI * rErrorInt
 				+ kD * rightDeriv + dirErr * kDP;
 		// Constrain
 		leftOutput = Math.max(-1, Math.min(1, leftOutput));
@@ -513,7 +513,7 @@ public class DynamicTankDriveFollower extends DynamicFollower<TankDriveMoment> {
 		lMotor.set(leftOutput);
 		rMotor.set(rightOutput);
 
-		lastTime = t;
+		lastTime = timestamp;
 		lLastErr = leftErr;
 		rLastErr = rightErr;
 
@@ -0,0 +1,266 @@
+package com.arctos6135.robotpathfinder.follower;
+
+import com.arctos6135.robotpathfinder.core.GlobalLibraryLoader;
+import com.arctos6135.robotpathfinder.core.lifecycle.GlobalLifeCycleManager;
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
+import com.arctos6135.robotpathfinder.follower.TankDriveFollower.TankDriveGains;
+
+/**
+ * Runs the control law of {@link TankDriveFollower} on a native thread at a
+ * fixed frequency.
+ * <p>
+ * Unlike the other follower runners, the control loop never enters Java code,
+ * so it is not affected by the garbage collector or the JIT compiler. On Linux,
+ * the thread sleeps until absolute deadlines with {@code clock_nanosleep()},
+ * and can optionally be given real-time ({@code SCHED_FIFO}) priority and be
+ * pinned to a CPU. On other platforms, the priority and CPU are ignored.
+ * </p>
+ * <p>
+ * Since the sensors and motors are accessed from Java, the control loop does
+ * not call them directly. Instead, sensor readings are passed in with
+ * {@link #pushFeedback(double, double, double)}, and the motor outputs are
+ * retrieved with {@link #pollCommand(double[])}. Both of these are lock-free,
+ * so they never block the control loop; the control loop always uses the
+ * latest sensor readings, and only the latest command is kept.
+ * </p>
+ * <p>
+ * The runner keeps its own reference to the native trajectory, so it stays
+ * valid even if the {@link TankDriveTrajectory} object is freed. Like other JNI
+ * classes, the {@link #free()} or {@link #close()} method should be called to
+ * release the native resource when the object is no longer needed. This also
+ * stops the thread if it is still running.
+ * </p>
+ * 
+ * @author Tyler Tian
+ * @see TankDriveFollowerEngine
+ * @since 3.0.0
+ */
+public class RealTimeFollowerRunner extends JNIObject {
+
+	static {
+		GlobalLibraryLoader.load();
+		GlobalLifeCycleManager.initialize();
+	}
+
+	/**
+	 * Timing statistics of the control loop. All times are in seconds.
+	 * 
+	 * @author Tyler Tian
+	 * @since 3.0.0
+	 */
+	public static class Statistics {
+		/**
+		 * The number of iterations that were run.
+		 */
+		public final long iterations;
+		/**
+		 * The number of iterations that did not finish before the next deadline.
+		 */
+		public final long overruns;
+		/**
+		 * The mean of how late the iterations woke up after their deadlines.
+		 */
+		public final double meanJitter;
+		/**
+		 * The most an iteration woke up late after its deadline.
+		 */
+		public final double maxJitter;
+		/**
+		 * The longest time taken by an iteration.
+		 */
+		public final double maxExecutionTime;
+
+		/**
+		 * Creates a new {@link Statistics} object.
+		 * 
+		 * @param iterations       The number of iterations
+		 * @param overruns         The number of overruns
+		 * @param meanJitter       The mean jitter
+		 * @param maxJitter        The max jitter
+		 * @param maxExecutionTime The max execution time
+		 */
+		public Statistics(long iterations, long overruns, double meanJitter, double maxJitter,
+				double maxExecutionTime) {
+			this.iterations = iterations;
+			this.overruns = overruns;
+			this.meanJitter = meanJitter;
+			this.maxJitter = maxJitter;
+			this.maxExecutionTime = maxExecutionTime;
+		}
+
+		@Override
+		public String toString() {
+			return "{" + " iterations='" + iterations + "'" + ", overruns='" + overruns + "'" + ", meanJitter='"
+					+ meanJitter + "'" + ", maxJitter='" + maxJitter + "'" + ", maxExecutionTime='"
+					+ maxExecutionTime + "'" + "}";
+		}
+	}
+
+	private native void _construct(TankDriveTrajectory target, double kV, double kA, double kP, double kI,
+			double kD, double kDP);
+
+	/**
+	 * Creates a new {@link RealTimeFollowerRunner} for the specified trajectory.
+	 * 
+	 * @param target The trajectory to follow
+	 * @param gains  The gains of the control law
+	 * @throws IllegalStateException If the native resource of the trajectory has
+	 *                               already been freed
+	 */
+	public RealTimeFollowerRunner(TankDriveTrajectory target, TankDriveGains gains) {
+		_construct(target, gains.kV, gains.kA, gains.kP, gains.kI, gains.kD, gains.kDP);
+		GlobalLifeCycleManager.register(this);
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Override
+	protected native void _destroy();
+
+	private native void _start(double frequency, int priority, int cpu);
+
+	/**
+	 * Starts the control loop at the specified frequency, with the default
+	 * scheduling policy and no CPU affinity.
+	 * <p>
+	 * The latest sensor readings at the time the thread starts are used as the
+	 * starting point. If the runner has been stopped or has finished, it starts
+	 * following the trajectory again from the beginning.
+	 * </p>
+	 * 
+	 * @param frequency The frequency, in Hz, to run the control loop at
+	 * @throws IllegalArgumentException If the frequency is not positive
+	 * @throws IllegalStateException    If the runner is already running, or if the
+	 *                                  native resource has already been freed
+	 *                                  (see class Javadoc)
+	 */
+	public void start(double frequency) {
+		_start(frequency, 0, -1);
+	}
+
+	/**
+	 * Starts the control loop at the specified frequency, with the specified
+	 * real-time priority and CPU affinity.
+	 * <p>
+	 * Setting the priority and affinity usually requires extra permissions. If
+	 * they cannot be set, the control loop still runs, and
+	 * {@link #isRealTime()} returns {@code false}.
+	 * </p>
+	 * 
+	 * @param frequency The frequency, in Hz, to run the control loop at
+	 * @param priority  The {@code SCHED_FIFO} priority (1-99), or 0 to use the
+	 *                  default scheduling policy
+	 * @param cpu       The CPU to pin the thread to, or -1 to let it run on any
+	 *                  CPU
+	 * @throws IllegalArgumentException If the frequency is not positive
+	 * @throws IllegalStateException    If the runner is already running, or if the
+	 *                                  native resource has already been freed
+	 *                                  (see class Javadoc)
+	 */
+	public void start(double frequency, int priority, int cpu) {
+		_start(frequency, priority, cpu);
+	}
+
+	private native void _setTelemetry(TelemetryBuffer telemetry);
+
+	/**
+	 * Sets a buffer to record the state of every iteration into.
+	 * 
+	 * @param telemetry The buffer, or {@code null} to stop recording
+	 * @throws IllegalStateException If the runner is running, or if the native
+	 *                               resource of this object or the buffer has
+	 *                               already been freed (see class Javadoc)
+	 * @see TelemetryBuffer
+	 */
+	public void setTelemetry(TelemetryBuffer telemetry) {
+		_setTelemetry(telemetry);
+	}
+
+	/**
+	 * Stops the control loop and waits for the thread to exit.
+	 * <p>
+	 * A command of 0 for both motors is issued before the thread exits. If the
+	 * runner is not running, this method has no effect.
+	 * </p>
+	 * 
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native void stop();
+
+	/**
+	 * Returns whether the control loop is running.
+	 * 
+	 * @return Whether the control loop is running
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native boolean isRunning();
+
+	/**
+	 * Returns whether the end of the trajectory was reached the last time the
+	 * control loop ran.
+	 * 
+	 * @return Whether the trajectory has been followed to the end
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native boolean isFinished();
+
+	/**
+	 * Returns whether the priority and CPU passed to
+	 * {@link #start(double, int, int)} were applied to the thread.
+	 * 
+	 * @return Whether the real-time settings were applied
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native boolean isRealTime();
+
+	/**
+	 * Passes in the latest sensor readings.
+	 * <p>
+	 * A reading of {@code NaN} means that the sensor is not present, in the same
+	 * way as {@link TankDriveFollowerEngine#run(double, double, double, double, double[])}.
+	 * This method should only be called by one thread.
+	 * </p>
+	 * 
+	 * @param lPos      The position reading of the left wheel, or {@code NaN}
+	 * @param rPos      The position reading of the right wheel, or {@code NaN}
+	 * @param direction The direction reading of the robot, or {@code NaN}
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native void pushFeedback(double lPos, double rPos, double direction);
+
+	/**
+	 * Retrieves the latest motor outputs, if there are new ones since the last
+	 * call.
+	 * <p>
+	 * If there is a new command, the left output, right output and the time (in
+	 * seconds, of a monotonic clock) of the iteration that computed them are
+	 * written into the first three elements of the output array. Commands that
+	 * were not polled before a newer one was computed are dropped. This method
+	 * should only be called by one thread.
+	 * </p>
+	 * 
+	 * @param outputs An array of at least 3 elements to store the command in
+	 * @return Whether there was a new command
+	 * @throws IllegalArgumentException If the output array is too short
+	 * @throws IllegalStateException    If the native resource has already been
+	 *                                  freed (see class Javadoc)
+	 */
+	public native boolean pollCommand(double[] outputs);
+
+	/**
+	 * Retrieves the timing statistics of the control loop since it was last
+	 * started.
+	 * 
+	 * @return The statistics
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native Statistics getStatistics();
+}
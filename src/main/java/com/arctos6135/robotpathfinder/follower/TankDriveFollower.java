@@ -1,6 +1,7 @@
 package com.arctos6135.robotpathfinder.follower;
 
 import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
 import com.arctos6135.robotpathfinder.math.MathUtils;
 
 /**
@@ -22,6 +23,11 @@ import com.arctos6135.robotpathfinder.math.MathUtils;
  * <p>
  * See the documentation for {@link Follower} for usage instructions.
  * </p>
+ * <p>
+ * If the target is a {@link TankDriveTrajectory}, the control law is computed
+ * in native code by a {@link TankDriveFollowerEngine}, which avoids creating a
+ * new {@link TankDriveMoment} every iteration.
+ * </p>
  * 
  * @author Tyler Tian
  * @see Follower
@@ -49,6 +55,11 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	protected double leftOutput, rightOutput, leftDeriv, rightDeriv;
 	protected TankDriveMoment lastMoment;
 
+	// Used instead of the Java control law when the target is a TankDriveTrajectory
+	protected TankDriveFollowerEngine engine;
+	protected final double[] engineOutputs = new double[2];
+	protected TelemetryBuffer telemetry;
+
 	/**
 	 * A class that represents a set of gains for PIDVA control, specialized for
 	 * tank drive robots.
@@ -420,6 +431,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 			setGains((TankDriveGains) gains);
 		} else {
 			super.setGains(gains);
+			updateEngineGains();
 		}
 	}
 
@@ -431,6 +443,78 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	public void setGains(TankDriveGains gains) {
 		super.setGains((Gains) gains);
 		kDP = gains.kDP;
+		updateEngineGains();
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Deprecated
+	@Override
+	public void setGains(double kV, double kA, double kP, double kI, double kD) {
+		super.setGains(kV, kA, kP, kI, kD);
+		updateEngineGains();
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Deprecated
+	@Override
+	public void setA(double a) {
+		super.setA(a);
+		updateEngineGains();
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Deprecated
+	@Override
+	public void setV(double v) {
+		super.setV(v);
+		updateEngineGains();
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Deprecated
+	@Override
+	public void setP(double p) {
+		super.setP(p);
+		updateEngineGains();
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Deprecated
+	@Override
+	public void setI(double i) {
+		super.setI(i);
+		updateEngineGains();
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Deprecated
+	@Override
+	public void setD(double d) {
+		super.setD(d);
+		updateEngineGains();
+	}
+
+	/**
+	 * Passes the gains on to the native control law, which keeps its own copy of
+	 * them. This has to be called whenever any of the gains change, so that the
+	 * changes take effect while the follower is running.
+	 */
+	protected void updateEngineGains() {
+		if (engine != null) {
+			engine.setGains(getGains());
+		}
 	}
 
 	/**
@@ -474,6 +558,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	@Deprecated
 	public void setDP(double kDP) {
 		this.kDP = kDP;
+		updateEngineGains();
 	}
 
 	/**
@@ -543,8 +628,59 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 		this.rDistSrc = rDistSrc;
 	}
 
+	/**
+	 * Sets a buffer to record the state of every iteration into.
+	 * <p>
+	 * Telemetry is only recorded when the target is a {@link TankDriveTrajectory},
+	 * since the state is recorded by the native control law.
+	 * </p>
+	 * 
+	 * @param telemetry The buffer, or {@code null} to stop recording
+	 * @throws IllegalStateException If the follower is running
+	 * @see TelemetryBuffer
+	 */
+	public void setTelemetry(TelemetryBuffer telemetry) {
+		if (running) {
+			throw new IllegalStateException("Telemetry cannot be changed when follower is running");
+		}
+		this.telemetry = telemetry;
+		if (engine != null) {
+			engine.setTelemetry(telemetry);
+		}
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Override
+	public void setTarget(Followable<TankDriveMoment> target) {
+		super.setTarget(target);
+		// The engine has to be recreated for the new target
+		if (engine != null) {
+			engine.free();
+			engine = null;
+		}
+	}
+
 	@Override
 	protected void _initialize() {
+		if (target instanceof TankDriveTrajectory) {
+			if (engine == null) {
+				engine = new TankDriveFollowerEngine((TankDriveTrajectory) target, getGains());
+				if (telemetry != null) {
+					engine.setTelemetry(telemetry);
+				}
+			} else {
+				// Subclasses may have changed the gain fields directly
+				engine.setGains(getGains());
+			}
+			double timestamp = timer.getTimestamp();
+			engine.initialize(timestamp, lDistSrc != null ? lDistSrc.getPosition() : Double.NaN,
+					rDistSrc != null ? rDistSrc.getPosition() : Double.NaN,
+					directionSrc != null ? directionSrc.getDirection() : Double.NaN);
+			return;
+		}
+
 		// Reset the initial distance, direction and timestamp references
 		if (lDistSrc != null && rDistSrc != null) {
 			lInitDist = lDistSrc.getPosition();
@@ -561,6 +697,23 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 
 	@Override
 	protected boolean _run() {
+		if (engine != null) {
+			// Read the sensors and do everything else in a single native call
+			double timestamp = timer.getTimestamp();
+			double lPos = Double.NaN, rPos = Double.NaN;
+			if (lDistSrc != null && rDistSrc != null) {
+				lPos = lDistSrc.getPosition();
+				rPos = rDistSrc.getPosition();
+			}
+			double direction = directionSrc != null ? directionSrc.getDirection() : Double.NaN;
+			if (engine.run(timestamp, lPos, rPos, direction, engineOutputs)) {
+				return true;
+			}
+			lMotor.set(engineOutputs[0]);
+			rMotor.set(engineOutputs[1]);
+			return false;
+		}
+
 		// Calculate current t and time difference from last iteration
 		double timestamp = timer.getTimestamp();
 		double dt = timestamp - lastTime;
@@ -592,7 +745,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 		// Calculate outputs
 		leftOutput = kA * m.getLeftAcceleration() + kV * m.getLeftVelocity() + kP * leftErr + kI * lErrorInt
 				+ kD * leftDeriv - dirErr * kDP;
-		rightOutput = kA * m.getRightAcceleration() + kV * m.getRightVelocity() + kP * rightErr + kI * lErrorInt
+		rightOutput = kA * m.getRightAcceleration() + kV * m.getRightVelocity() + kP * rightErr + kI * rErrorInt
 				+ kD * rightDeriv + dirErr * kDP;
 		// Constrain
 		leftOutput = Math.max(-1, Math.min(1, leftOutput));
@@ -601,7 +754,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 		lMotor.set(leftOutput);
 		rMotor.set(rightOutput);
 
-		lastTime = t;
+		lastTime = timestamp;
 		lLastErr = leftErr;
 		rLastErr = rightErr;
 
@@ -625,7 +778,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last left positional error
 	 */
 	public double lastLeftError() {
-		return leftErr;
+		return engine != null ? engine.lastLeftError() : leftErr;
 	}
 
 	/**
@@ -637,7 +790,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last right positional error
 	 */
 	public double lastRightError() {
-		return rightErr;
+		return engine != null ? engine.lastRightError() : rightErr;
 	}
 
 	/**
@@ -649,7 +802,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last left error integral
 	 */
 	public double lastLeftIntegral() {
-		return lErrorInt;
+		return engine != null ? engine.lastLeftIntegral() : lErrorInt;
 	}
 
 	/**
@@ -661,7 +814,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last right error integral
 	 */
 	public double lastRightIntegral() {
-		return rErrorInt;
+		return engine != null ? engine.lastRightIntegral() : rErrorInt;
 	}
 
 	/**
@@ -673,7 +826,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last directional error
 	 */
 	public double lastDirectionalError() {
-		return dirErr;
+		return engine != null ? engine.lastDirectionalError() : dirErr;
 	}
 
 	/**
@@ -685,7 +838,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last left derivative error
 	 */
 	public double lastLeftDerivative() {
-		return leftDeriv;
+		return engine != null ? engine.lastLeftDerivative() : leftDeriv;
 	}
 
 	/**
@@ -697,7 +850,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last right derivative error
 	 */
 	public double lastRightDerivative() {
-		return rightDeriv;
+		return engine != null ? engine.lastRightDerivative() : rightDeriv;
 	}
 
 	/**
@@ -706,7 +859,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last left output
 	 */
 	public double lastLeftOutput() {
-		return leftOutput;
+		return engine != null ? engine.lastLeftOutput() : leftOutput;
 	}
 
 	/**
@@ -715,7 +868,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last right output
 	 */
 	public double lastRightOutput() {
-		return rightOutput;
+		return engine != null ? engine.lastRightOutput() : rightOutput;
 	}
 
 	/**
@@ -730,7 +883,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 */
 	@Deprecated
 	public double lastLeftVelocity() {
-		return lastMoment.getLeftVelocity();
+		return lastMoment().getLeftVelocity();
 	}
 
 	/**
@@ -745,7 +898,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 */
 	@Deprecated
 	public double lastRightVelocity() {
-		return lastMoment.getRightVelocity();
+		return lastMoment().getRightVelocity();
 	}
 
 	/**
@@ -760,7 +913,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 */
 	@Deprecated
 	public double lastLeftAcceleration() {
-		return lastMoment.getLeftAcceleration();
+		return lastMoment().getLeftAcceleration();
 	}
 
 	/**
@@ -775,7 +928,7 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 */
 	@Deprecated
 	public double lastRightAcceleration() {
-		return lastMoment.getRightAcceleration();
+		return lastMoment().getRightAcceleration();
 	}
 
 	/**
@@ -785,6 +938,6 @@ public class TankDriveFollower extends Follower<TankDriveMoment> {
 	 * @return The last moment retrieved from the target
 	 */
 	public TankDriveMoment lastMoment() {
-		return lastMoment;
+		return engine != null ? engine.lastMoment() : lastMoment;
 	}
 }
@@ -0,0 +1,226 @@
+package com.arctos6135.robotpathfinder.follower;
+
+import com.arctos6135.robotpathfinder.core.GlobalLibraryLoader;
+import com.arctos6135.robotpathfinder.core.lifecycle.GlobalLifeCycleManager;
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
+import com.arctos6135.robotpathfinder.follower.TankDriveFollower.TankDriveGains;
+
+/**
+ * The native implementation of the control law of {@link TankDriveFollower},
+ * for following a {@link TankDriveTrajectory}.
+ * <p>
+ * Each iteration of the control loop is done with a single call to
+ * {@link #run(double, double, double, double, double[])}, which takes the
+ * sensor readings and writes the two motor outputs into an array. The moment
+ * of the trajectory is looked up in native code, and no objects are created.
+ * The engine also remembers where in the trajectory it was, so that each lookup
+ * only has to search forwards from the last one.
+ * </p>
+ * <p>
+ * {@link TankDriveFollower} automatically uses this class when its target is a
+ * {@link TankDriveTrajectory}. It can also be used directly, for code that
+ * reads its sensors and sets its motors by itself.
+ * </p>
+ * <p>
+ * The engine keeps its own reference to the native trajectory, so it stays
+ * valid even if the {@link TankDriveTrajectory} object is freed. Like other
+ * JNI classes, the {@link #free()} or {@link #close()} method should be called
+ * to release the native resource when the object is no longer needed.
+ * </p>
+ * 
+ * @author Tyler Tian
+ * @see TankDriveFollower
+ * @since 3.0.0
+ */
+public class TankDriveFollowerEngine extends JNIObject {
+
+	static {
+		GlobalLibraryLoader.load();
+		GlobalLifeCycleManager.initialize();
+	}
+
+	private native void _construct(TankDriveTrajectory target, double kV, double kA, double kP, double kI,
+			double kD, double kDP);
+
+	/**
+	 * Creates a new {@link TankDriveFollowerEngine} for the specified trajectory.
+	 * 
+	 * @param target The trajectory to follow
+	 * @param gains  The gains of the control law
+	 * @throws IllegalStateException If the native resource of the trajectory has
+	 *                               already been freed
+	 */
+	public TankDriveFollowerEngine(TankDriveTrajectory target, TankDriveGains gains) {
+		_construct(target, gains.kV, gains.kA, gains.kP, gains.kI, gains.kD, gains.kDP);
+		GlobalLifeCycleManager.register(this);
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Override
+	protected native void _destroy();
+
+	private native void _setGains(double kV, double kA, double kP, double kI, double kD, double kDP);
+
+	/**
+	 * Sets the gains of the control law.
+	 * 
+	 * @param gains The new gains
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public void setGains(TankDriveGains gains) {
+		_setGains(gains.kV, gains.kA, gains.kP, gains.kI, gains.kD, gains.kDP);
+	}
+
+	private native void _setTelemetry(TelemetryBuffer telemetry);
+
+	/**
+	 * Sets a buffer to record the state of every iteration into.
+	 * 
+	 * @param telemetry The buffer, or {@code null} to stop recording
+	 * @throws IllegalStateException If the native resource of this object or the
+	 *                               buffer has already been freed (see class
+	 *                               Javadoc)
+	 * @see TelemetryBuffer
+	 */
+	public void setTelemetry(TelemetryBuffer telemetry) {
+		_setTelemetry(telemetry);
+	}
+
+	/**
+	 * Resets the engine, using the current time and sensor readings as the
+	 * starting point.
+	 * <p>
+	 * A sensor reading of {@code NaN} means that the sensor is not present. If
+	 * either of the position readings is {@code NaN}, the PID terms are not used;
+	 * if the direction reading is {@code NaN}, the directional term is not used.
+	 * </p>
+	 * 
+	 * @param timestamp The current time
+	 * @param lPos      The position reading of the left wheel, or {@code NaN}
+	 * @param rPos      The position reading of the right wheel, or {@code NaN}
+	 * @param direction The direction reading of the robot, or {@code NaN}
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native void initialize(double timestamp, double lPos, double rPos, double direction);
+
+	/**
+	 * Runs a single iteration of the control loop.
+	 * <p>
+	 * The sensor readings follow the same rules as in
+	 * {@link #initialize(double, double, double, double) initialize()}. If the
+	 * trajectory has not ended, the left and right motor outputs are written into
+	 * the first two elements of the output array.
+	 * </p>
+	 * 
+	 * @param timestamp The current time
+	 * @param lPos      The position reading of the left wheel, or {@code NaN}
+	 * @param rPos      The position reading of the right wheel, or {@code NaN}
+	 * @param direction The direction reading of the robot, or {@code NaN}
+	 * @param outputs   An array of at least 2 elements to store the outputs in
+	 * @return Whether the trajectory has ended
+	 * @throws IllegalArgumentException If the output array is too short
+	 * @throws IllegalStateException    If the native resource has already been
+	 *                                  freed (see class Javadoc)
+	 */
+	public native boolean run(double timestamp, double lPos, double rPos, double direction, double[] outputs);
+
+	/**
+	 * Retrieves the moment of the trajectory used in the last iteration.
+	 * <p>
+	 * Unlike the other methods in this class, this creates a new object every time
+	 * it is called.
+	 * </p>
+	 * 
+	 * @return The last moment
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native TankDriveMoment lastMoment();
+
+	/**
+	 * Retrieves the last positional error of the left wheel.
+	 * 
+	 * @return The last left positional error
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastLeftError();
+
+	/**
+	 * Retrieves the last positional error of the right wheel.
+	 * 
+	 * @return The last right positional error
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastRightError();
+
+	/**
+	 * Retrieves the last directional error.
+	 * 
+	 * @return The last directional error
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastDirectionalError();
+
+	/**
+	 * Retrieves the last integral of the positional error of the left wheel.
+	 * 
+	 * @return The last left integral
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastLeftIntegral();
+
+	/**
+	 * Retrieves the last integral of the positional error of the right wheel.
+	 * 
+	 * @return The last right integral
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastRightIntegral();
+
+	/**
+	 * Retrieves the last derivative of the positional error of the left wheel.
+	 * 
+	 * @return The last left derivative
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastLeftDerivative();
+
+	/**
+	 * Retrieves the last derivative of the positional error of the right wheel.
+	 * 
+	 * @return The last right derivative
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastRightDerivative();
+
+	/**
+	 * Retrieves the last output of the left wheel.
+	 * 
+	 * @return The last left output
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastLeftOutput();
+
+	/**
+	 * Retrieves the last output of the right wheel.
+	 * 
+	 * @return The last right output
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native double lastRightOutput();
+}
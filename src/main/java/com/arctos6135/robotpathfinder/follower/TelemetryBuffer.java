@@ -0,0 +1,217 @@
+package com.arctos6135.robotpathfinder.follower;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import com.arctos6135.robotpathfinder.core.GlobalLibraryLoader;
+import com.arctos6135.robotpathfinder.core.lifecycle.GlobalLifeCycleManager;
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
+
+/**
+ * A native buffer that records the state of every iteration of a native
+ * follower, for logging.
+ * <p>
+ * The last value getters of the followers (such as
+ * {@link TankDriveFollower#lastLeftError()}) only return the state of the
+ * latest iteration, so logging from another thread misses iterations. Instead,
+ * a {@link TelemetryBuffer} can be set on a {@link TankDriveFollower},
+ * {@link TankDriveFollowerEngine} or {@link RealTimeFollowerRunner}, which
+ * then writes a record into it every iteration. The records are then taken out
+ * in bulk with {@link #drain(ByteBuffer)}, which copies them directly into the
+ * memory of a direct {@link ByteBuffer} without creating any objects.
+ * </p>
+ * <p>
+ * The buffer is a lock-free ring buffer with a fixed capacity, so writing to it
+ * never slows down the control loop. If the buffer is full, new records are
+ * dropped and counted (see {@link #dropped()}). Only one follower may write to
+ * a buffer, and it should only be drained by one thread at a time.
+ * </p>
+ * <p>
+ * Each record is {@link #RECORD_SIZE} bytes long, and consists of the
+ * following doubles in the native byte order: the timestamp, the time into the
+ * trajectory, the left, right and directional errors, the left and right
+ * integrals, the left and right derivatives, and the left and right outputs.
+ * {@link Record#read(ByteBuffer)} can be used to read them.
+ * </p>
+ * <p>
+ * Followers keep their own reference to the native buffer, so it stays valid
+ * even if this object is freed. Like other JNI classes, the {@link #free()} or
+ * {@link #close()} method should be called to release the native resource when
+ * the object is no longer needed.
+ * </p>
+ * 
+ * @author Tyler Tian
+ * @since 3.0.0
+ */
+public class TelemetryBuffer extends JNIObject {
+
+	static {
+		GlobalLibraryLoader.load();
+		GlobalLifeCycleManager.initialize();
+	}
+
+	/**
+	 * The size of a single record, in bytes.
+	 */
+	public static final int RECORD_SIZE = 11 * Double.BYTES;
+
+	/**
+	 * A single telemetry record.
+	 * 
+	 * @author Tyler Tian
+	 * @since 3.0.0
+	 */
+	public static class Record {
+		/**
+		 * The timestamp passed to the follower.
+		 */
+		public double timestamp;
+		/**
+		 * The time into the trajectory.
+		 */
+		public double time;
+		/**
+		 * The positional error of the left wheel.
+		 */
+		public double leftError;
+		/**
+		 * The positional error of the right wheel.
+		 */
+		public double rightError;
+		/**
+		 * The directional error.
+		 */
+		public double directionalError;
+		/**
+		 * The integral of the positional error of the left wheel.
+		 */
+		public double leftIntegral;
+		/**
+		 * The integral of the positional error of the right wheel.
+		 */
+		public double rightIntegral;
+		/**
+		 * The derivative of the positional error of the left wheel.
+		 */
+		public double leftDerivative;
+		/**
+		 * The derivative of the positional error of the right wheel.
+		 */
+		public double rightDerivative;
+		/**
+		 * The output of the left wheel.
+		 */
+		public double leftOutput;
+		/**
+		 * The output of the right wheel.
+		 */
+		public double rightOutput;
+
+		/**
+		 * Reads a record from the current position of the buffer, and advances the
+		 * position past it.
+		 * <p>
+		 * The buffer must be in the native byte order; see
+		 * {@link TelemetryBuffer#allocate(int)}.
+		 * </p>
+		 * 
+		 * @param buffer The buffer to read from
+		 * @return The record
+		 */
+		public static Record read(ByteBuffer buffer) {
+			Record r = new Record();
+			r.timestamp = buffer.getDouble();
+			r.time = buffer.getDouble();
+			r.leftError = buffer.getDouble();
+			r.rightError = buffer.getDouble();
+			r.directionalError = buffer.getDouble();
+			r.leftIntegral = buffer.getDouble();
+			r.rightIntegral = buffer.getDouble();
+			r.leftDerivative = buffer.getDouble();
+			r.rightDerivative = buffer.getDouble();
+			r.leftOutput = buffer.getDouble();
+			r.rightOutput = buffer.getDouble();
+			return r;
+		}
+	}
+
+	/**
+	 * Allocates a direct {@link ByteBuffer} in the native byte order, large enough
+	 * to hold the specified number of records.
+	 * 
+	 * @param records The number of records
+	 * @return A new buffer that can be passed to {@link #drain(ByteBuffer)}
+	 */
+	public static ByteBuffer allocate(int records) {
+		return ByteBuffer.allocateDirect(records * RECORD_SIZE).order(ByteOrder.nativeOrder());
+	}
+
+	private native void _construct(int capacity);
+
+	/**
+	 * Creates a new {@link TelemetryBuffer}.
+	 * 
+	 * @param capacity The number of records the buffer can hold; rounded up to a
+	 *                 power of 2
+	 * @throws IllegalArgumentException If the capacity is not positive
+	 */
+	public TelemetryBuffer(int capacity) {
+		_construct(capacity);
+		GlobalLifeCycleManager.register(this);
+	}
+
+	/**
+	 * {@inheritDoc}
+	 */
+	@Override
+	protected native void _destroy();
+
+	private native int _drain(ByteBuffer buffer, int position, int remaining);
+
+	/**
+	 * Moves as many records as will fit into the buffer, oldest first.
+	 * <p>
+	 * The records are written starting at the position of the buffer, and the
+	 * position is advanced past them.
+	 * </p>
+	 * 
+	 * @param buffer A direct buffer to write the records into
+	 * @return The number of records moved
+	 * @throws IllegalArgumentException If the buffer is not a direct buffer
+	 * @throws IllegalStateException    If the native resource has already been
+	 *                                  freed (see class Javadoc)
+	 */
+	public int drain(ByteBuffer buffer) {
+		int count = _drain(buffer, buffer.position(), buffer.remaining());
+		buffer.position(buffer.position() + count * RECORD_SIZE);
+		return count;
+	}
+
+	/**
+	 * Returns the number of records waiting to be drained.
+	 * 
+	 * @return The number of records
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native int size();
+
+	/**
+	 * Returns the number of records the buffer can hold.
+	 * 
+	 * @return The capacity
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native int capacity();
+
+	/**
+	 * Returns the number of records that were dropped because the buffer was
+	 * full.
+	 * 
+	 * @return The number of dropped records
+	 * @throws IllegalStateException If the native resource has already been freed
+	 *                               (see class Javadoc)
+	 */
+	public native long dropped();
+}
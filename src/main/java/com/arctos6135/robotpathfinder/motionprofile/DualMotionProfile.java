@@ -1,5 +1,7 @@
 package com.arctos6135.robotpathfinder.motionprofile;
 
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
+
 /**
  * This class is a wrapper around two {@link MotionProfile}s.
  * <p>
@@ -14,7 +16,7 @@ package com.arctos6135.robotpathfinder.motionprofile;
  * @see MotionProfile
  * @since 3.0.0
  */
-public class DualMotionProfile<T extends MotionProfile> {
+public class DualMotionProfile<T extends MotionProfile> implements AutoCloseable {
 
     protected T leftProfile, rightProfile;
 
@@ -117,4 +119,27 @@ public class DualMotionProfile<T extends MotionProfile> {
     public double rightAcceleration(double t) {
         return rightProfile.acceleration(t);
     }
+
+    /**
+     * Frees the native resources of both profiles, if they have any (e.g.
+     * {@link TrapezoidalMotionProfile}). The profiles cannot be used afterwards.
+     */
+    public void free() {
+        free(leftProfile);
+        free(rightProfile);
+    }
+
+    /**
+     * Same as {@link #free()}.
+     */
+    @Override
+    public void close() {
+        free();
+    }
+
+    private static void free(MotionProfile profile) {
+        if (profile instanceof JNIObject) {
+            ((JNIObject) profile).free();
+        }
+    }
 }
@@ -1,7 +1,9 @@
 package com.arctos6135.robotpathfinder.motionprofile;
 
+import com.arctos6135.robotpathfinder.core.GlobalLibraryLoader;
 import com.arctos6135.robotpathfinder.core.RobotSpecs;
-import com.arctos6135.robotpathfinder.math.MathUtils;
+import com.arctos6135.robotpathfinder.core.lifecycle.GlobalLifeCycleManager;
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
 
 /**
  * This class represents a trapezoidal motion profile.
@@ -22,43 +24,46 @@ import com.arctos6135.robotpathfinder.math.MathUtils;
  * <p>
  * This motion profile is {@link DynamicMotionProfile dynamic}.
  * </p>
+ * <h2>Memory Management</h2>
+ * <p>
+ * The profile itself is computed and stored in native code, so that querying
+ * and updating it does not create any objects on the JVM. Like trajectories,
+ * this class holds a handle to a native resource, and the {@link #free()} or
+ * {@link #close()} method should be called to free it when the object is no
+ * longer needed. Objects that are not freed will still be freed when they are
+ * garbage collected.
+ * </p>
  * 
  * @author Tyler Tian
  * @since 3.0.0
  */
-public class TrapezoidalMotionProfile implements DynamicMotionProfile, Cloneable {
-
-    protected double initVel;
-    protected double initDist, initTime;
+public class TrapezoidalMotionProfile extends JNIObject implements DynamicMotionProfile, Cloneable {
 
-    protected double distance;
-    protected double maxAcl, maxVel;
-    protected double cruiseVel;
-
-    protected double tAccel, tCruise, tTotal;
-    protected double accelDist, cruiseDist;
-
-    protected boolean reverse = false;
+    static {
+        GlobalLibraryLoader.load();
+        GlobalLifeCycleManager.initialize();
+    }
 
     protected final RobotSpecs specs;
 
+    private native void _construct(double maxV, double maxA, double dist, double initVel);
+
     @Override
     public String toString() {
-        return "\u001b[92m[\u001b[4mTMP" + this.hashCode() + "\u001b[24m with initVel=" + initVel + ", initDist="
-                + initDist + ", initTime=" + initTime + ", distance=" + distance + ", maxAcl=" + maxAcl + ", maxVel="
-                + maxVel + ", cruiseVel=" + cruiseVel + ", tAccel=" + tAccel + ", tCruise=" + tCruise + ", tTotal="
-                + tTotal + ", accelDist=" + accelDist + ", cruiseDist=" + cruiseDist + ", reverse=" + reverse
-                + "]\u001b[0m";
+        return "\u001b[92m[\u001b[4mTMP" + this.hashCode() + "\u001b[24m with specs=" + specs + ", totalTime="
+                + totalTime() + ", reverse=" + isReversed() + "]\u001b[0m";
     }
 
     /**
-     * Constructs a new object of this type without initializing any values.
+     * Constructs a new object of this type from an existing native resource.
      * <p>
      * This constructor should only ever be used internally.
      * </p>
      */
-    private TrapezoidalMotionProfile(RobotSpecs specs) {
+    private TrapezoidalMotionProfile(RobotSpecs specs, long ptr) {
         this.specs = specs;
+        _nativePtr = ptr;
+        GlobalLifeCycleManager.register(this);
     }
 
     /**
@@ -69,8 +74,7 @@ public class TrapezoidalMotionProfile implements DynamicMotionProfile, Cloneable
      *              for backwards motion
      */
     public TrapezoidalMotionProfile(RobotSpecs specs, double dist) {
-        this.specs = specs;
-        construct(specs, dist, 0);
+        this(specs, dist, 0);
     }
 
     /**
@@ -85,104 +89,33 @@ public class TrapezoidalMotionProfile implements DynamicMotionProfile, Cloneable
      */
     public TrapezoidalMotionProfile(RobotSpecs specs, double dist, double initVel) {
         this.specs = specs;
-        construct(specs, dist, initVel);
+        _construct(specs.getMaxVelocity(), specs.getMaxAcceleration(), dist, initVel);
+        GlobalLifeCycleManager.register(this);
     }
 
     /**
-     * Constructs the motion profile.
-     * <p>
-     * Used by the constructor and {@link #update(double, double, double, double)}.
-     * </p>
-     * 
-     * @param maxVel   The max velocity
-     * @param maxAccel The max acceleration
-     * @param dist     The distance to cover
-     * @param initVel  The initial velocity
-     * @return Whether or not the motion profile overshoots
+     * {@inheritDoc}
      */
-    private boolean construct(RobotSpecs specs, double dist, double initVel) {
-        if (dist < 0) {
-            reverse = true;
-            dist = -dist;
-            initVel = -initVel;
-        }
-        distance = dist;
-        maxAcl = specs.getMaxAcceleration();
-        maxVel = Math.max(specs.getMaxVelocity(), Math.abs(initVel));
-        this.initVel = initVel;
-
-        // // Use MathUtils functions to compare floats
-        // if (MathUtils.floatGt(Math.abs(initVel), maxVel)) {
-        // throw new IllegalArgumentException("Initial velocity too high!");
-        // }
-
-        // Calculate the distance covered when accelerating and decelerating
-        // Formula is derived from the kinematic formula relating velocities, distance
-        // and acceleration, and the fact that dAccel + dDecel = dist
-        // Assumes there is no maximum cap on velocity
-        double dAccel = dist / 2 - initVel * initVel / (4 * maxAcl);
-        double dDecel;
-        // If the acceleration distance is less than 0, the distance is not enough to
-        // decelerate back to 0
-        // Change the maximum acceleration so that we can
-        boolean overshoot = false;
-        if (dAccel < 0) {
-            // Unless the distance left is 0
-            // In which case we promptly give up and call it a day
-            if (dist == 0) {
-                System.err.println("WTF");
-                tAccel = tCruise = tTotal = 0;
-                return true;
-            }
-            // This value should make dAccel equal to 0
-            this.maxAcl = initVel * initVel / (2 * dist);
-            dDecel = dist;
-            overshoot = true;
-        } else {
-            dDecel = dist - dAccel;
-        }
-        // Calculate cruise velocity
-        double vc = Math.sqrt(2 * maxAcl * dDecel);
-        cruiseVel = Math.min(vc, maxVel);
-
-        // Calculate acceleration time
-        tAccel = (cruiseVel - initVel) / maxAcl;
-        // Re-calculate the acceleration distance
-        // This is needed because the first result does not take into account the actual
-        // max velocity
-        // First kinematic formula
-        accelDist = tAccel * tAccel * maxAcl * 0.5 + initVel * tAccel;
-        // Calculate the deceleration time
-        double tDecel = cruiseVel / maxAcl;
-        // Re-calculate the deceleration distance
-        double decelDist = tDecel * tDecel * maxAcl * 0.5;
-
-        // Calculate the cruise distance
-        cruiseDist = dist - accelDist - decelDist;
-        // Calculate the cruise time
-        tCruise = cruiseDist / cruiseVel;
-        // tTotal is the total time in the range of this motion profile
-        // It does not include initTime
-        tTotal = tAccel + tCruise + tDecel;
-        return overshoot;
-    }
+    @Override
+    protected native void _destroy();
 
     /**
      * {@inheritDoc}
+     * 
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
      */
     @Override
-    public double totalTime() {
-        // Add initTime to tTotal to get the absolute time
-        return tTotal + initTime;
-    }
+    public native double totalTime();
 
     /**
      * {@inheritDoc}
+     * 
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
      */
     @Override
-    public boolean isReversed() {
-        return reverse;
-    }
+    public native boolean isReversed();
 
     /**
      * {@inheritDoc}
@@ -194,38 +127,11 @@ public class TrapezoidalMotionProfile implements DynamicMotionProfile, Cloneable
      * </p>
      * 
      * @throws IllegalArgumentException If the time is out of range
+     * @throws IllegalStateException    If the native resource has already been
+     *                                  freed (see class Javadoc)
      */
     @Override
-    public double position(double time) {
-        if (MathUtils.floatLt(time, initTime)) {
-            throw new IllegalArgumentException(
-                    String.format("Time out of range (%f not in [%f, %f])!", time, initTime, initTime + tTotal));
-        }
-        time -= initTime;
-        double result = 0;
-        // When accelerating
-        if (time < tAccel) {
-            result = time * time * maxAcl * 1 / 2 + initVel * time;
-        }
-        // When cruising
-        else if (time < tAccel + tCruise) {
-            // The distance is the distance covered during acceleration and rest of the time
-            // multiplied by the cruise velocity
-            result = accelDist + (time - tAccel) * cruiseVel;
-        }
-        // When decelerating
-        else if (MathUtils.floatLtEq(time, tTotal)) {
-            // The distance is the distance covered during acceleration and cruising, plus
-            // the distance covered during deceleration,
-            // which can be solved using the third kinematic formula
-            double t = time - tAccel - tCruise;
-            result = accelDist + cruiseDist + t * cruiseVel - t * t * maxAcl * 0.5;
-        } else {
-            throw new IllegalArgumentException(String.format("Time out of range (%f not in [%f, %f])!", time + initTime,
-                    initTime, initTime + tTotal));
-        }
-        return (reverse ? -result : result) + initDist;
-    }
+    public native double position(double time);
 
     /**
      * {@inheritDoc}
@@ -237,36 +143,11 @@ public class TrapezoidalMotionProfile implements DynamicMotionProfile, Cloneable
      * </p>
      * 
      * @throws IllegalArgumentException If the time is out of range
+     * @throws IllegalStateException    If the native resource has already been
+     *                                  freed (see class Javadoc)
      */
     @Override
-    public double velocity(double time) {
-        if (MathUtils.floatLt(time, initTime)) {
-            throw new IllegalArgumentException(
-                    String.format("Time out of range (%f not in [%f, %f])!", time, initTime, initTime + tTotal));
-        }
-        time -= initTime;
-        double result = 0;
-        // When accelerating
-        if (time < tAccel) {
-            // The velocity is just the time multiplied by the acceleration
-            result = time * maxAcl + initVel;
-        }
-        // When cruising
-        else if (time < tAccel + tCruise) {
-            // The velocity is the cruise velocity
-            result = cruiseVel;
-        }
-        // When decelerating
-        else if (MathUtils.floatLtEq(time, tTotal)) {
-            // The velocity is the cruise velocity minus the acceleration times the time
-            // decelerating
-            result = cruiseVel - (time - tAccel - tCruise) * maxAcl;
-        } else {
-            throw new IllegalArgumentException(String.format("Time out of range (%f not in [%f, %f])!", time + initTime,
-                    initTime, initTime + tTotal));
-        }
-        return reverse ? -result : result;
-    }
+    public native double velocity(double time);
 
     /**
      * {@inheritDoc}
@@ -278,43 +159,42 @@ public class TrapezoidalMotionProfile implements DynamicMotionProfile, Cloneable
      * </p>
      * 
      * @throws IllegalArgumentException If the time is out of range
+     * @throws IllegalStateException    If the native resource has already been
+     *                                  freed (see class Javadoc)
      */
     @Override
-    public double acceleration(double time) {
-        if (MathUtils.floatLt(time, initTime)) {
-            throw new IllegalArgumentException(
-                    String.format("Time out of range (%f not in [%f, %f])!", time, initTime, initTime + tTotal));
-        }
-        time -= initTime;
-        double result = 0;
-        // When accelerating
-        if (time < tAccel) {
-            result = maxAcl;
-        }
-        // When cruising
-        else if (time < tAccel + tCruise) {
-            result = 0;
-        }
-        // When decelerating
-        else if (MathUtils.floatLtEq(time, tTotal)) {
-            result = -maxAcl;
-        } else {
-            throw new IllegalArgumentException(String.format("Time out of range (%f not in [%f, %f])!", time + initTime,
-                    initTime, initTime + tTotal));
-        }
-        return reverse ? -result : result;
-    }
+    public native double acceleration(double time);
+
+    /**
+     * Samples the position, velocity and acceleration of this profile at many
+     * times with a single native call.
+     * <p>
+     * The results are written into the arrays passed in, so that no objects are
+     * created. Any of the output arrays can be {@code null} if those values are
+     * not needed; otherwise, they must be at least as long as the array of times.
+     * </p>
+     * 
+     * @param times The times to sample at
+     * @param pos   The array to store the positions in, or {@code null}
+     * @param vel   The array to store the velocities in, or {@code null}
+     * @param accel The array to store the accelerations in, or {@code null}
+     * @throws IllegalArgumentException If any of the times is out of range, or if
+     *                                  an output array is too short
+     * @throws IllegalStateException    If the native resource has already been
+     *                                  freed (see class Javadoc)
+     */
+    public native void sample(double[] times, double[] pos, double[] vel, double[] accel);
 
     /**
      * {@inheritDoc}
+     * 
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
      */
     @Override
-    public boolean update(double currentTime, double currentDist, double currentVel, double currentAccel) {
-        initTime = currentTime;
-        double prevInitDist = initDist;
-        initDist = currentDist;
-        return construct(specs, (reverse ? -distance : distance) + prevInitDist - currentDist, currentVel);
-    }
+    public native boolean update(double currentTime, double currentDist, double currentVel, double currentAccel);
+
+    private native long _copy();
 
     /**
      * {@inheritDoc}
@@ -326,28 +206,15 @@ public class TrapezoidalMotionProfile implements DynamicMotionProfile, Cloneable
 
     /**
      * {@inheritDoc}
+     * <p>
+     * The copy has its own native resource, which must be freed separately.
+     * </p>
+     * 
+     * @throws IllegalStateException If the native resource has already been freed
+     *                               (see class Javadoc)
      */
     @Override
     public TrapezoidalMotionProfile copy() {
-        TrapezoidalMotionProfile profile = new TrapezoidalMotionProfile(specs);
-        profile.initVel = initVel;
-        profile.initDist = initDist;
-        profile.initTime = initTime;
-
-        profile.distance = distance;
-        profile.maxAcl = maxAcl;
-        profile.maxVel = maxVel;
-        profile.cruiseVel = cruiseVel;
-
-        profile.tAccel = tAccel;
-        profile.tCruise = tCruise;
-        profile.tTotal = tTotal;
-
-        profile.accelDist = accelDist;
-        profile.cruiseDist = cruiseDist;
-
-        profile.reverse = reverse;
-
-        return profile;
+        return new TrapezoidalMotionProfile(specs, _copy());
     }
 }
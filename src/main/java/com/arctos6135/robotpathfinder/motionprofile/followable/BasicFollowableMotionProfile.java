@@ -1,5 +1,6 @@
 package com.arctos6135.robotpathfinder.motionprofile.followable;
 
+import com.arctos6135.robotpathfinder.core.lifecycle.JNIObject;
 import com.arctos6135.robotpathfinder.core.trajectory.BasicMoment;
 import com.arctos6135.robotpathfinder.motionprofile.MotionProfile;
 
@@ -23,6 +24,16 @@ public abstract class BasicFollowableMotionProfile<T extends MotionProfile>
 
     protected T profile;
 
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void free() {
+        if (profile instanceof JNIObject) {
+            ((JNIObject) profile).free();
+        }
+    }
+
     /**
      * {@inheritDoc}
      */
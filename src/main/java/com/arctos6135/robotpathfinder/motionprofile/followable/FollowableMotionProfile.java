@@ -11,6 +11,27 @@ import com.arctos6135.robotpathfinder.follower.Followable;
  *            subclass of {@link Moment}
  * @since 3.0.0
  */
-public abstract class FollowableMotionProfile<T extends Moment> implements Followable<T> {
+public abstract class FollowableMotionProfile<T extends Moment> implements Followable<T>, AutoCloseable {
     protected double initialFacing = Math.PI / 2;
+
+    /**
+     * Frees the native resources of the motion profile.
+     * <p>
+     * Like trajectories, the motion profiles (e.g.
+     * {@link com.arctos6135.robotpathfinder.motionprofile.TrapezoidalMotionProfile
+     * TrapezoidalMotionProfile}) are stored in native code, so this or
+     * {@link #close()} should be called once this object is no longer needed. It
+     * cannot be used afterwards. Copies have their own native resources, and must
+     * be freed separately.
+     * </p>
+     */
+    public abstract void free();
+
+    /**
+     * Same as {@link #free()}.
+     */
+    @Override
+    public void close() {
+        free();
+    }
 }
@@ -23,6 +23,14 @@ public abstract class TankDriveFollowableMotionProfile<T extends DualMotionProfi
 
     protected T profile;
 
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void free() {
+        profile.free();
+    }
+
     /**
      * {@inheritDoc}
      */
@@ -25,6 +25,14 @@ public abstract class TankDriveFollowableRotationMotionProfile<T extends DualMot
 
     protected T profile;
 
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void free() {
+        profile.free();
+    }
+
     /**
      * The width of the base plate of the robot. Must be set by the constructors of
      * implementing classes!!
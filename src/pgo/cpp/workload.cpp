@@ -0,0 +1,198 @@
+#include "followers.h"
+#include "motionprofiles.h"
+#include "paths.h"
+#include "trajectories.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*
+ * The training workload for profile-guided optimization.
+ *
+ * This drives the core through what a robot program does with it: generating trajectories of
+ * every path type and turns in place, querying them the way followers and the visualizer do,
+ * mirroring them, running the tank drive follower, querying paths directly, and sampling motion
+ * profiles. Every input is fixed (including the seed for the random queries), so the resulting
+ * profile is reproducible.
+ *
+ * A checksum of the results is printed at the end. It should not change between the default and
+ * the optimized builds, apart from the last few digits because of floating point differences.
+ */
+
+using namespace rpf;
+
+namespace {
+    // Accumulates results so that nothing can be optimized away
+    double checksum = 0;
+
+    std::vector<Waypoint> make_waypoints(int count, double turn) {
+        std::vector<Waypoint> waypoints;
+        for (int i = 0; i < count; i++) {
+            waypoints.push_back(Waypoint(i % 2 ? turn : 0.0, i * 1.5, pi / 2));
+        }
+        return waypoints;
+    }
+
+    TrajectoryParams make_params(
+            int waypoints, int samples, bool tank, PathType type, GeneratorType generator) {
+        TrajectoryParams params;
+        params.waypoints = make_waypoints(waypoints, 1.0);
+        params.alpha = 2;
+        params.sample_count = samples;
+        params.is_tank = tank;
+        params.type = type;
+        params.generator = generator;
+        return params;
+    }
+
+    void query(const BasicTrajectory &traj, std::mt19937 &rng) {
+        double total = traj.total_time();
+        std::uniform_real_distribution<double> dist(0, total);
+        // In order, like a follower
+        for (int i = 0; i <= 500; i++) {
+            checksum += traj.get(total * i / 500).vel;
+        }
+        // Random, like the visualizer or a path being rescheduled
+        for (int i = 0; i < 500; i++) {
+            checksum += traj.get(dist(rng)).accel;
+            checksum += traj.get_pos(dist(rng)).x;
+        }
+    }
+
+    void query(const TankDriveTrajectory &traj, std::mt19937 &rng) {
+        double total = traj.total_time();
+        std::uniform_real_distribution<double> dist(0, total);
+        std::size_t cursor = 0;
+        for (int i = 0; i <= 500; i++) {
+            checksum += traj.get(total * i / 500, cursor).l_vel;
+        }
+        for (int i = 0; i < 500; i++) {
+            checksum += traj.get(dist(rng)).r_vel;
+            checksum += traj.get_pos(dist(rng)).y;
+        }
+    }
+
+    // Follows the trajectory with perfect sensor readings at 200 Hz
+    void follow(std::shared_ptr<const TankDriveTrajectory> traj) {
+        TankDriveFollower follower(traj, TankDriveGains(0.2, 0.02, 0.8, 0, 0.05, 0.5));
+        follower.initialize(0, 0, 0, traj->get(0).heading);
+        double left = 0, right = 0;
+        for (double t = 0;; t += 0.005) {
+            TankDriveMoment m = traj->get(t);
+            if (follower.run(t, m.l_pos, m.r_pos, m.heading, left, right)) {
+                break;
+            }
+            checksum += left - right;
+        }
+    }
+
+    void generation_round(std::mt19937 &rng) {
+        RobotSpecs specs(5, 8, 0.6);
+        const PathType types[] = {PathType::BEZIER, PathType::CUBIC_HERMITE,
+                PathType::QUINTIC_HERMITE, PathType::QUINTIC_HERMITE_C2, PathType::CLOTHOID};
+        const int samples[] = {200, 1000, 4000};
+
+        for (auto type : types) {
+            for (int n : samples) {
+                BasicTrajectory basic(
+                        specs, make_params(4, n, false, type, GeneratorType::TWO_PASS));
+                query(basic, rng);
+                checksum += basic.mirror_lr()->total_time() + basic.retrace()->total_time();
+
+                auto tank = std::make_shared<const TankDriveTrajectory>(
+                        specs, make_params(4, n, true, type, GeneratorType::TWO_PASS));
+                query(*tank, rng);
+                checksum += tank->mirror_fb()->total_time();
+                follow(tank);
+            }
+        }
+        // Turns in place
+        for (double angle : {-pi, -0.3, 0.3, pi / 2, pi}) {
+            auto rotation = std::make_shared<const TankDriveTrajectory>(
+                    TankDriveRotationProfile(specs, angle));
+            query(*rotation, rng);
+            follow(rotation);
+        }
+        // More waypoints
+        for (int count : {2, 8, 20}) {
+            TankDriveTrajectory tank(BasicTrajectory(specs,
+                    make_params(count, 2000, true, PathType::QUINTIC_HERMITE,
+                            GeneratorType::TWO_PASS)));
+            query(tank, rng);
+        }
+        // Generated a bit at a time, like a robot does on its main thread
+        {
+            IncrementalGenerator gen(specs,
+                    make_params(4, 4000, true, PathType::QUINTIC_HERMITE, GeneratorType::TWO_PASS),
+                    true);
+            while (!gen.step(100)) {
+                checksum += gen.progress();
+            }
+            query(*gen.get_tank(), rng);
+        }
+        // Streamed, with the settled part followed while the rest is generated
+        {
+            IncrementalGenerator gen(specs,
+                    make_params(4, 4000, true, PathType::QUINTIC_HERMITE, GeneratorType::TWO_PASS),
+                    true, true);
+            while (!gen.step(100)) {
+                if (gen.available()) {
+                    checksum += gen.get_tank()->get(gen.available_time() / 2).l_vel;
+                }
+            }
+            query(*gen.get_tank(), rng);
+        }
+    }
+
+    // Direct path queries, as made through the Java Path class
+    void path_round(std::mt19937 &rng) {
+        std::uniform_real_distribution<double> dist(0, 1);
+        for (int type = 1; type <= 5; type++) {
+            Path path(make_waypoints(4, 1.0), 2, static_cast<PathType>(type));
+            path.compute_len(1000);
+            for (int i = 0; i < 1000; i++) {
+                double t = dist(rng);
+                checksum += path.at(t).x + path.deriv_at(t).y + path.curvature_at(t);
+                checksum += path.t2s(t) + path.s2t(dist(rng));
+            }
+        }
+    }
+
+    void motion_profile_round() {
+        RobotSpecs specs(5, 8, 0.6);
+        for (double dist : {-4.0, 0.5, 3.0, 20.0}) {
+            TrapezoidalMotionProfile profile(specs, dist);
+            double total = profile.total_time();
+            for (int i = 0; i <= 1000; i++) {
+                double pos, vel, accel;
+                profile.sample(total * i / 1000, pos, vel, accel);
+                checksum += pos + vel + accel;
+            }
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    int rounds = 3;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--rounds=", 9) == 0) {
+            rounds = std::atoi(argv[i] + 9);
+        }
+        else {
+            std::fprintf(stderr, "Usage: %s [--rounds=N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::mt19937 rng(1234);
+    for (int i = 0; i < rounds; i++) {
+        generation_round(rng);
+        path_round(rng);
+        motion_profile_round();
+    }
+    std::printf("checksum: %.6e\n", checksum);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "testing.h"
+#include "trajectory/asyncgeneration.h"
+#include <chrono>
+#include <future>
+#include <thread>
+
+// Once wait() returns for a job that was cancelled while pending, its future is already ready
+void test_cancel_pending_publishes_first() {
+    rpf::RobotSpecs specs(3, 2, 1);
+    rpf::TrajectoryParams params;
+    params.waypoints = {rpf::Waypoint(0, 0, 0), rpf::Waypoint(10, 5, 0)};
+    params.alpha = 10;
+    rpf::ThreadPool pool(1);
+    for (int trial = 0; trial < 200; trial++) {
+        // Keep the only thread busy so that the job stays in the queue
+        std::promise<void> release;
+        auto released = release.get_future().share();
+        pool.submit([released]() { released.wait(); });
+        auto job = rpf::AsyncTrajectory<rpf::BasicTrajectory>::start(specs, params, pool);
+
+        bool ready = false;
+        std::thread waiter([&]() {
+            job->wait();
+            ready = job->get_future().wait_for(std::chrono::seconds(0))
+                    == std::future_status::ready;
+        });
+        RPF_EXPECT(job->cancel());
+        RPF_EXPECT(!job->cancel());
+        waiter.join();
+        release.set_value();
+
+        RPF_EXPECT(ready);
+        RPF_EXPECT(job->get_status() == rpf::GenerationJob::Status::CANCELLED);
+        RPF_EXPECT_THROWS(job->get(), rpf::GenerationCancelled);
+    }
+}
+RPF_TEST(test_cancel_pending_publishes_first);
@@ -0,0 +1,91 @@
+#include "testing.h"
+#include "trajectories.h"
+#include "trajectory/incrementalgenerator.h"
+#include <stdexcept>
+
+namespace {
+    rpf::TrajectoryParams make_params(bool tank) {
+        rpf::TrajectoryParams params;
+        params.waypoints = {rpf::Waypoint(0, 0, 0), rpf::Waypoint(10, 5, 0)};
+        params.alpha = 10;
+        params.sample_count = 500;
+        params.type = rpf::PathType::QUINTIC_HERMITE;
+        params.is_tank = tank;
+        return params;
+    }
+} // namespace
+
+// step() keeps returning true once generation is done, until the trajectory is taken
+void test_step_after_done() {
+    rpf::RobotSpecs specs(3, 2, 1);
+    rpf::IncrementalGenerator gen(specs, make_params(false), false);
+    while (!gen.step(1000)) {
+    }
+    for (int i = 0; i < 5; i++) {
+        RPF_EXPECT(gen.step(1000));
+    }
+    gen.run();
+    RPF_EXPECT(gen.is_done());
+    auto traj = gen.get_basic();
+    RPF_EXPECT(traj->moment_count() == 500);
+    RPF_EXPECT_THROWS(gen.step(1000), std::runtime_error);
+    RPF_EXPECT_THROWS(gen.run(), std::runtime_error);
+    RPF_EXPECT_THROWS(gen.get_basic(), std::runtime_error);
+}
+RPF_TEST(test_step_after_done);
+
+// In streaming mode the trajectory is never taken, so step() can be called forever
+void test_step_after_done_streaming() {
+    rpf::RobotSpecs specs(3, 2, 1);
+    rpf::IncrementalGenerator gen(specs, make_params(true), true, true);
+    while (!gen.step(1000)) {
+    }
+    auto traj = gen.get_tank();
+    for (int i = 0; i < 5; i++) {
+        RPF_EXPECT(gen.step(1000));
+        RPF_EXPECT(gen.get_tank() == traj);
+    }
+    RPF_EXPECT(traj->moment_count() == 500);
+    RPF_EXPECT(gen.available() == 500);
+}
+RPF_TEST(test_step_after_done_streaming);
+
+// A failed generator rethrows its exception every time, instead of trying to continue
+void test_step_after_failure() {
+    rpf::RobotSpecs specs(3, 2, 1);
+    auto params = make_params(false);
+    // The velocity constraint cannot be met
+    params.waypoints[0].velocity = 100;
+    rpf::IncrementalGenerator gen(specs, params, false);
+    RPF_EXPECT_THROWS(gen.run(), std::invalid_argument);
+    RPF_EXPECT_THROWS(gen.step(1000), std::invalid_argument);
+    RPF_EXPECT_THROWS(gen.step(1000), std::invalid_argument);
+}
+RPF_TEST(test_step_after_failure);
+
+// TIME_OPTIMAL goes through the same passes as TWO_PASS, so the trajectories are identical
+void test_time_optimal_same_as_two_pass() {
+    rpf::RobotSpecs specs(5, 8, 0.6);
+    for (bool streaming : {false, true}) {
+        auto params = make_params(true);
+        params.waypoints.push_back(rpf::Waypoint(0, 10, rpf::pi, 1.5));
+        params.waypoints.push_back(rpf::Waypoint(-5, 5, -rpf::pi / 2));
+        rpf::IncrementalGenerator two_pass(specs, params, true, streaming);
+        params.generator = rpf::GeneratorType::TIME_OPTIMAL;
+        rpf::IncrementalGenerator time_optimal(specs, params, true, streaming);
+        two_pass.run();
+        time_optimal.run();
+
+        auto expected = two_pass.get_tank()->get_moments();
+        auto actual = time_optimal.get_tank()->get_moments();
+        RPF_EXPECT(expected.size() == actual.size());
+        for (std::size_t i = 0; i < expected.size() && i < actual.size(); i++) {
+            RPF_EXPECT(expected[i].time == actual[i].time);
+            RPF_EXPECT(expected[i].l_vel == actual[i].l_vel);
+            RPF_EXPECT(expected[i].r_vel == actual[i].r_vel);
+            RPF_EXPECT(expected[i].l_accel == actual[i].l_accel);
+            RPF_EXPECT(expected[i].r_accel == actual[i].r_accel);
+        }
+    }
+}
+RPF_TEST(test_time_optimal_same_as_two_pass);
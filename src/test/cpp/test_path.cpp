@@ -0,0 +1,62 @@
+#include "testing.h"
+#include "math/rpfmath.h"
+#include "paths.h"
+#include "segments.h"
+#include <cmath>
+#include <random>
+
+namespace {
+    // Waypoints that turn both ways, with alpha in proportion to the distance between them
+    std::vector<rpf::Waypoint> make_waypoints(std::mt19937 &rng, int count, double &alpha) {
+        std::uniform_real_distribution<double> pos(-100, 100), heading(-rpf::pi, rpf::pi);
+        std::vector<rpf::Waypoint> waypoints;
+        alpha = 0;
+        for (int i = 0; i < count; i++) {
+            waypoints.push_back(rpf::Waypoint(pos(rng), pos(rng), heading(rng)));
+            if (i > 0) {
+                rpf::Vec2D diff = static_cast<rpf::Vec2D>(waypoints[i]) - waypoints[i - 1];
+                alpha += diff.magnitude() / (count - 1);
+            }
+        }
+        return waypoints;
+    }
+} // namespace
+
+// The curvature of QUINTIC_HERMITE_C2 paths is the same on both sides of every interior waypoint
+void test_quintic_hermite_c2_curvature_continuity() {
+    std::mt19937 rng(2);
+    for (int trial = 0; trial < 100; trial++) {
+        double alpha;
+        auto waypoints = make_waypoints(rng, 3 + trial % 10, alpha);
+        rpf::Path path(waypoints, alpha, rpf::PathType::QUINTIC_HERMITE_C2);
+        int segments = static_cast<int>(waypoints.size()) - 1;
+        for (int i = 1; i < segments; i++) {
+            double t = static_cast<double>(i) / segments;
+            double d = path.deriv_at(t).magnitude();
+            // Rounding errors scale with the second derivative
+            double scale = path.second_deriv_at(t).magnitude() / (d * d);
+            RPF_EXPECT_NEAR(path.curvature_at(t - 1e-9), path.curvature_at(t + 1e-9), scale * 1e-3);
+        }
+    }
+}
+RPF_TEST(test_quintic_hermite_c2_curvature_continuity);
+
+// Clothoid segments start and end at their points, with their headings
+void test_clothoid_endpoints() {
+    std::mt19937 rng(3);
+    for (int trial = 0; trial < 100; trial++) {
+        double alpha;
+        auto waypoints = make_waypoints(rng, 2, alpha);
+        rpf::ClothoidSegment segment(static_cast<rpf::Vec2D>(waypoints[0]),
+                static_cast<rpf::Vec2D>(waypoints[1]), waypoints[0].heading, waypoints[1].heading);
+        for (int end = 0; end < 2; end++) {
+            auto pos = segment.at(end);
+            auto deriv = segment.deriv_at(end);
+            RPF_EXPECT_NEAR(pos.x, waypoints[end].x, 1e-9);
+            RPF_EXPECT_NEAR(pos.y, waypoints[end].y, 1e-9);
+            RPF_EXPECT_NEAR(
+                    rpf::angle_diff(std::atan2(deriv.y, deriv.x), waypoints[end].heading), 0, 1e-9);
+        }
+    }
+}
+RPF_TEST(test_clothoid_endpoints);
@@ -0,0 +1,121 @@
+#include "testing.h"
+#include "trajectories.h"
+#include <cmath>
+
+namespace {
+    constexpr double EPS = 1e-9;
+    constexpr double TURN = rpf::pi / 2;
+
+    bool same_angle(double a, double b) {
+        return std::abs(rpf::angle_diff(a, b)) < EPS;
+    }
+
+    rpf::TankDriveTrajectory make_rotation() {
+        return rpf::TankDriveTrajectory(
+                rpf::TankDriveRotationProfile(rpf::RobotSpecs(5, 8, 0.6), TURN));
+    }
+} // namespace
+
+// A turn in place starts and ends at the right headings without moving, and is still tank
+void test_rotation_get() {
+    auto traj = make_rotation();
+    double end = traj.total_time();
+    RPF_EXPECT(traj.get_params().is_tank);
+    RPF_EXPECT(!traj.get_path());
+    RPF_EXPECT(traj.moment_count() == 2);
+
+    RPF_EXPECT(same_angle(traj.get(0).heading, rpf::pi / 2));
+    RPF_EXPECT(same_angle(traj.get(end).heading, rpf::pi / 2 + TURN));
+    // Turning counterclockwise drives the left wheel backwards
+    RPF_EXPECT_NEAR(traj.get(end).l_pos, -TURN * 0.3, EPS);
+    RPF_EXPECT_NEAR(traj.get(end).r_pos, TURN * 0.3, EPS);
+    for (double t : {0.0, end / 3, end / 2, end}) {
+        auto pos = traj.get_pos(t);
+        RPF_EXPECT(pos.x == 0 && pos.y == 0);
+        RPF_EXPECT(same_angle(pos.heading, traj.get(t).heading));
+        RPF_EXPECT(!traj.get(t).backwards);
+    }
+}
+RPF_TEST(test_rotation_get);
+
+// Mirroring left to right turns the other way from the same heading
+void test_rotation_mirror_lr() {
+    auto traj = make_rotation();
+    auto mirrored = traj.mirror_lr();
+    double end = traj.total_time();
+    RPF_EXPECT_NEAR(mirrored->total_time(), end, EPS);
+    for (double t : {0.0, end / 3, end}) {
+        auto m = traj.get(t);
+        auto mm = mirrored->get(t);
+        RPF_EXPECT_NEAR(mm.l_pos, m.r_pos, EPS);
+        RPF_EXPECT_NEAR(mm.r_pos, m.l_pos, EPS);
+        RPF_EXPECT(same_angle(mm.heading, rpf::mirror_angle(m.heading, rpf::pi / 2)));
+    }
+}
+RPF_TEST(test_rotation_mirror_lr);
+
+// Mirroring front to back drives both wheels the other way, with the headings flipped like the
+// ones of a path, and mirroring twice gets the original back
+void test_rotation_mirror_fb() {
+    auto traj = make_rotation();
+    auto mirrored = traj.mirror_fb();
+    auto twice = mirrored->mirror_fb();
+    double end = traj.total_time();
+    RPF_EXPECT(same_angle(mirrored->get_init_facing(), traj.get_init_facing()));
+    for (double t : {0.0, end / 3, end}) {
+        auto m = traj.get(t);
+        auto mm = mirrored->get(t);
+        RPF_EXPECT_NEAR(mm.l_pos, -m.l_pos, EPS);
+        RPF_EXPECT_NEAR(mm.r_pos, -m.r_pos, EPS);
+        RPF_EXPECT_NEAR(mm.l_vel, -m.l_vel, EPS);
+        RPF_EXPECT(same_angle(mm.heading, rpf::mirror_angle(m.heading, rpf::pi)));
+        RPF_EXPECT(mm.backwards);
+        RPF_EXPECT(same_angle(mm.init_facing, m.init_facing));
+
+        auto mt = twice->get(t);
+        RPF_EXPECT_NEAR(mt.l_pos, m.l_pos, EPS);
+        RPF_EXPECT(same_angle(mt.heading, m.heading));
+        RPF_EXPECT(!mt.backwards);
+    }
+    RPF_EXPECT(mirrored->moment(0).backwards);
+}
+RPF_TEST(test_rotation_mirror_fb);
+
+// Retracing turns back from where the turn ended
+void test_rotation_retrace() {
+    auto traj = make_rotation();
+    auto retraced = traj.retrace();
+    double end = traj.total_time();
+    RPF_EXPECT_NEAR(retraced->total_time(), end, EPS);
+    for (double t : {0.0, end / 3, end}) {
+        RPF_EXPECT(same_angle(retraced->get(t).heading, traj.get(end - t).heading));
+    }
+    RPF_EXPECT_NEAR(retraced->get(end).l_pos, -traj.get(end).l_pos, EPS);
+}
+RPF_TEST(test_rotation_retrace);
+
+// A subtrajectory of a turn starts at the heading it had at the start of the window
+void test_rotation_subtrajectory() {
+    auto traj = make_rotation();
+    double end = traj.total_time();
+    auto sub = traj.subtrajectory(end / 4, end / 2);
+    RPF_EXPECT_NEAR(sub->total_time(), end / 4, EPS);
+    RPF_EXPECT_NEAR(sub->get(0).l_pos, 0, EPS);
+    RPF_EXPECT(same_angle(sub->get(0).heading, traj.get(end / 4).heading));
+    RPF_EXPECT(same_angle(sub->get(end / 4).heading, traj.get(end / 2).heading));
+    RPF_EXPECT_NEAR(sub->get(end / 4).r_pos, traj.get(end / 2).r_pos - traj.get(end / 4).r_pos,
+            EPS);
+    RPF_EXPECT(same_angle(sub->get_pos(end / 8).heading, traj.get(end * 3 / 8).heading));
+}
+RPF_TEST(test_rotation_subtrajectory);
+
+// Params that are not set are the same as the defaults of the Java TrajectoryParams
+void test_params_defaults() {
+    rpf::TrajectoryParams params;
+    RPF_EXPECT(params.sample_count == 1000);
+    RPF_EXPECT(!params.is_tank);
+    RPF_EXPECT(params.type == rpf::PathType::QUINTIC_HERMITE);
+    RPF_EXPECT(params.generator == rpf::GeneratorType::TWO_PASS);
+    RPF_EXPECT(std::isnan(params.alpha));
+}
+RPF_TEST(test_params_defaults);
@@ -0,0 +1,62 @@
+#include "testing.h"
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+namespace rpf {
+    namespace test {
+
+        namespace {
+            struct Test {
+                const char *name;
+                Function func;
+            };
+
+            // Function-local so that it is constructed before the registrars use it
+            std::vector<Test> &registry() {
+                static std::vector<Test> tests;
+                return tests;
+            }
+
+            int failures = 0;
+        } // namespace
+
+        void register_test(const char *name, Function func) {
+            registry().push_back(Test{name, func});
+        }
+
+        void fail(const char *file, int line, const std::string &message) {
+            failures++;
+            std::printf("  %s:%d: %s\n", file, line, message.c_str());
+        }
+    } // namespace test
+} // namespace rpf
+
+/*
+ * Runs every test, or only the ones whose names contain the first argument.
+ * Returns 1 if any of them failed.
+ */
+int main(int argc, char **argv) {
+    const char *filter = argc > 1 ? argv[1] : "";
+    int failed = 0, run = 0;
+    for (const auto &test : rpf::test::registry()) {
+        if (!std::strstr(test.name, filter)) {
+            continue;
+        }
+        run++;
+        std::printf("%s\n", test.name);
+        int before = rpf::test::failures;
+        try {
+            test.func();
+        }
+        catch (const std::exception &e) {
+            rpf::test::fail(__FILE__, __LINE__, std::string("Uncaught exception: ") + e.what());
+        }
+        if (rpf::test::failures != before) {
+            failed++;
+        }
+    }
+    std::printf("%d tests, %d failed\n", run, failed);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+
+/*
+ * A small self-contained test framework for the native core, in the style of the benchmarks.
+ *
+ * Tests are functions registered with RPF_TEST, which check conditions with RPF_EXPECT:
+ *
+ *     void test_something() {
+ *         RPF_EXPECT(something() == 1);
+ *         RPF_EXPECT_NEAR(something_close(), 0.5, 1e-9);
+ *         RPF_EXPECT_THROWS(something_else(), std::invalid_argument);
+ *     }
+ *     RPF_TEST(test_something);
+ *
+ * A failed check is reported and the test keeps going, so every failure is seen in one run.
+ * An exception that escapes a test fails it.
+ */
+namespace rpf {
+    namespace test {
+        using Function = void (*)();
+
+        void register_test(const char *name, Function func);
+        // Records a failed check of the test that is running
+        void fail(const char *file, int line, const std::string &message);
+
+        struct Registrar {
+            Registrar(const char *name, Function func) {
+                register_test(name, func);
+            }
+        };
+    } // namespace test
+} // namespace rpf
+
+#define RPF_TEST_CONCAT2(a, b) a##b
+#define RPF_TEST_CONCAT(a, b) RPF_TEST_CONCAT2(a, b)
+#define RPF_TEST(func)                                                                             \
+    static rpf::test::Registrar RPF_TEST_CONCAT(rpf_test_, __LINE__)(#func, func)
+#define RPF_EXPECT(cond)                                                                           \
+    do {                                                                                           \
+        if (!(cond)) {                                                                             \
+            rpf::test::fail(__FILE__, __LINE__, #cond);                                            \
+        }                                                                                          \
+    } while (0)
+#define RPF_EXPECT_NEAR(a, b, tolerance)                                                           \
+    do {                                                                                           \
+        if (!(std::abs((a) - (b)) <= (tolerance))) {                                               \
+            rpf::test::fail(__FILE__, __LINE__, #a " is not within " #tolerance " of " #b);        \
+        }                                                                                          \
+    } while (0)
+#define RPF_EXPECT_THROWS(expr, type)                                                              \
+    do {                                                                                           \
+        bool rpf_thrown = false;                                                                   \
+        try {                                                                                      \
+            expr;                                                                                  \
+        }                                                                                          \
+        catch (const type &) {                                                                     \
+            rpf_thrown = true;                                                                     \
+        }                                                                                          \
+        if (!rpf_thrown) {                                                                         \
+            rpf::test::fail(__FILE__, __LINE__, #expr " did not throw " #type);                    \
+        }                                                                                          \
+    } while (0)
@@ -0,0 +1,214 @@
+package com.arctos6135.robotpathfinder.tests.core.path;
+
+import static org.hamcrest.Matchers.closeTo;
+import static org.hamcrest.Matchers.lessThan;
+import static org.junit.Assert.assertThat;
+import static org.junit.Assert.fail;
+
+import com.arctos6135.robotpathfinder.core.Waypoint;
+import com.arctos6135.robotpathfinder.core.path.Path;
+import com.arctos6135.robotpathfinder.core.path.PathType;
+import com.arctos6135.robotpathfinder.math.MathUtils;
+import com.arctos6135.robotpathfinder.math.Vec2D;
+import com.arctos6135.robotpathfinder.tests.TestHelper;
+import com.arctos6135.robotpathfinder.tests.core.trajectory.TrajectoryTestingUtils;
+
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TestName;
+
+/**
+ * This class contains tests for {@link Path}.
+ * 
+ * @author Tyler Tian
+ */
+public class PathTest {
+
+    @Rule
+    public TestName testName = new TestName();
+
+    /**
+     * Performs tests on {@link Path#curvatureAt(double)}.
+     * 
+     * This test generates a {@link Path} and loops through 100 different points in
+     * time, ensuring that the curvature matches the one computed from the
+     * derivatives, and that it never exceeds the bound given by
+     * {@link Path#curvatureBoundAt(double)}.
+     */
+    @Test
+    public void testCurvature() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        Path path = new Path(TrajectoryTestingUtils.getRandomWaypoints(helper),
+                helper.getDouble("alpha", 1, 100000), TrajectoryTestingUtils.getRandomPathType(helper));
+
+        for (int i = 0; i <= 100; i++) {
+            double t = i / 100.0;
+            Vec2D d = path.derivAt(t);
+            Vec2D dd = path.secondDerivAt(t);
+            double expected = MathUtils.curvature(d.getX(), dd.getX(), d.getY(), dd.getY());
+            double curvature = path.curvatureAt(t);
+
+            assertThat("Curvature should match the one computed from the derivatives", curvature,
+                    closeTo(expected, Math.abs(expected) * 1e-6 + MathUtils.getFloatCompareThreshold()));
+            if (MathUtils.floatGt(Math.abs(curvature) / path.curvatureBoundAt(t), 1)) {
+                fail("The curvature of the Path exceeded the bound at time " + t);
+            }
+        }
+        path.close();
+    }
+
+    /**
+     * Performs tests on {@link Path#curvaturesAt(double[])} and
+     * {@link Path#curvatureDerivsAt(double[])}.
+     * 
+     * This test generates a {@link Path} and verifies that the batched methods
+     * return the same values as the single-time methods.
+     */
+    @Test
+    public void testBatchedCurvature() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        Path path = new Path(TrajectoryTestingUtils.getRandomWaypoints(helper),
+                helper.getDouble("alpha", 1, 100000), TrajectoryTestingUtils.getRandomPathType(helper));
+
+        double[] times = new double[101];
+        for (int i = 0; i < times.length; i++) {
+            times[i] = i / 100.0;
+        }
+        double[] curvatures = path.curvaturesAt(times);
+        double[] derivs = path.curvatureDerivsAt(times);
+        for (int i = 0; i < times.length; i++) {
+            assertThat("Batched curvature should be the same", curvatures[i],
+                    closeTo(path.curvatureAt(times[i]), MathUtils.getFloatCompareThreshold()));
+            assertThat("Batched curvature derivative should be the same", derivs[i],
+                    closeTo(path.curvatureDerivAt(times[i]), MathUtils.getFloatCompareThreshold()));
+        }
+        path.close();
+    }
+
+    /**
+     * Performs tests on the curvature of {@link PathType#QUINTIC_HERMITE_C2} paths.
+     * 
+     * This test generates a {@link Path} with at least one interior waypoint and
+     * asserts that the curvature just before each interior waypoint is the same as
+     * the curvature just after it. The tolerance is relative to the size of the
+     * second derivative, since that is what the rounding errors scale with.
+     */
+    @Test
+    public void testQuinticHermiteC2CurvatureContinuity() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        Waypoint[] waypoints = TrajectoryTestingUtils.getRandomWaypoints(helper,
+                helper.getInt("waypointsCount", 3, 100));
+        // Keep alpha in proportion to the distance between the waypoints, so that the path does
+        // not have cusps, where the curvature cannot be compared
+        double alpha = 0;
+        for (int i = 1; i < waypoints.length; i++) {
+            alpha += new Vec2D(waypoints[i]).distTo(new Vec2D(waypoints[i - 1])) / (waypoints.length - 1);
+        }
+        alpha *= helper.getDouble("alphaScale", 0.5, 2);
+        Path path = new Path(waypoints, alpha, PathType.QUINTIC_HERMITE_C2);
+
+        double eps = 1e-9;
+        for (int i = 1; i < waypoints.length - 1; i++) {
+            double t = (double) i / (waypoints.length - 1);
+            double d = path.derivAt(t).magnitude();
+            double scale = path.secondDerivAt(t).magnitude() / (d * d);
+
+            assertThat("Curvature should be continuous at waypoint " + i, path.curvatureAt(t - eps),
+                    closeTo(path.curvatureAt(t + eps), scale * 1e-3 + MathUtils.getFloatCompareThreshold()));
+        }
+        path.close();
+    }
+
+    /**
+     * Performs tests on the ends of the segments of {@link PathType#CLOTHOID}
+     * paths.
+     * 
+     * This test generates a {@link Path} and asserts that it passes through every
+     * waypoint with the heading of the waypoint, both at the end of the segment
+     * before the waypoint and at the start of the segment after it.
+     */
+    @Test
+    public void testClothoidEndpoints() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        Waypoint[] waypoints = TrajectoryTestingUtils.getRandomWaypoints(helper);
+        Path path = new Path(waypoints, helper.getDouble("alpha", 1, 100000), PathType.CLOTHOID);
+
+        double eps = 1e-12;
+        for (int i = 0; i < waypoints.length; i++) {
+            double t = (double) i / (waypoints.length - 1);
+            for (double time : new double[] { t - eps, t, t + eps }) {
+                if (time < 0 || time > 1) {
+                    continue;
+                }
+                Vec2D pos = path.at(time);
+                Vec2D deriv = path.derivAt(time);
+                // Moving away from the waypoint by eps only moves the position by about this much
+                double tolerance = deriv.magnitude() * eps * 2
+                        + (Math.abs(waypoints[i].getX()) + Math.abs(waypoints[i].getY())) * 1e-9
+                        + MathUtils.getFloatCompareThreshold();
+
+                assertThat("The path should pass through waypoint " + i, pos.getX(),
+                        closeTo(waypoints[i].getX(), tolerance));
+                assertThat("The path should pass through waypoint " + i, pos.getY(),
+                        closeTo(waypoints[i].getY(), tolerance));
+                assertThat("The heading at waypoint " + i + " should be the same as the waypoint's",
+                        Math.abs(MathUtils.angleDiff(Math.atan2(deriv.getY(), deriv.getX()),
+                                waypoints[i].getHeading())),
+                        lessThan(1e-6));
+            }
+        }
+        path.close();
+    }
+
+    /**
+     * Performs tests on {@link Path#transformed(double, double, double)}.
+     * 
+     * This test generates a {@link Path} and transforms it by a random rotation
+     * and translation. It then loops through 100 different points in time and
+     * verifies that the positions and derivatives are transformed, and that the
+     * curvature stays the same.
+     */
+    @Test
+    public void testTransformed() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        Path path = new Path(TrajectoryTestingUtils.getRandomWaypoints(helper),
+                helper.getDouble("alpha", 1, 100000), TrajectoryTestingUtils.getRandomPathType(helper));
+        double x = helper.getDouble("x", -100, 100);
+        double y = helper.getDouble("y", -100, 100);
+        double angle = helper.getDouble("angle", -Math.PI, Math.PI);
+        path.computeLen(1000);
+        Path transformed = path.transformed(x, y, angle);
+
+        assertThat("The length should be the same", transformed.getLength(),
+                closeTo(path.getLength(), MathUtils.getFloatCompareThreshold()));
+        double c = Math.cos(angle);
+        double s = Math.sin(angle);
+        for (int i = 0; i <= 100; i++) {
+            double t = i / 100.0;
+            Vec2D p0 = path.at(t);
+            Vec2D p1 = transformed.at(t);
+            Vec2D d0 = path.derivAt(t);
+            Vec2D d1 = transformed.derivAt(t);
+
+            assertThat("The x should be transformed", p1.getX(),
+                    closeTo(c * p0.getX() - s * p0.getY() + x, MathUtils.getFloatCompareThreshold()));
+            assertThat("The y should be transformed", p1.getY(),
+                    closeTo(s * p0.getX() + c * p0.getY() + y, MathUtils.getFloatCompareThreshold()));
+            assertThat("The derivative should be rotated", d1.getX(),
+                    closeTo(c * d0.getX() - s * d0.getY(), MathUtils.getFloatCompareThreshold()));
+            assertThat("The derivative should be rotated", d1.getY(),
+                    closeTo(s * d0.getX() + c * d0.getY(), MathUtils.getFloatCompareThreshold()));
+            assertThat("The curvature should be the same", transformed.curvatureAt(t),
+                    closeTo(path.curvatureAt(t), MathUtils.getFloatCompareThreshold()));
+            assertThat("The lookup table should be the same", transformed.s2T(t),
+                    closeTo(path.s2T(t), 0));
+        }
+        path.close();
+        transformed.close();
+    }
+}
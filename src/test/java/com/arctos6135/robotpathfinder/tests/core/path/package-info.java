@@ -0,0 +1,5 @@
+/**
+ * Contains unit tests for classes in the package
+ * {@code com.arctos6135.robotpathfinder.core.path}.
+ */
+package com.arctos6135.robotpathfinder.tests.core.path;
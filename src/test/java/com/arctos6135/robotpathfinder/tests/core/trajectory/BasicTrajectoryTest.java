@@ -327,4 +327,107 @@ public class BasicTrajectoryTest {
 
         traj.close();
     }
+
+    /**
+     * Performs tests on {@link BasicTrajectory#timeScaled(double)}.
+     * 
+     * This test generates a {@link BasicTrajectory} and scales it by a random
+     * factor. It then loops through 100 different points in time and verifies that
+     * the scaled trajectory is the original trajectory with its times multiplied
+     * by the factor, velocities divided by it, and accelerations divided by its
+     * square.
+     */
+    @Test
+    public void testBasicTrajectoryTimeScaled() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, false);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        double factor = helper.getDouble("factor", 0.5, 3);
+
+        BasicTrajectory original = new BasicTrajectory(specs, params);
+        BasicTrajectory scaled = original.timeScaled(factor);
+
+        assertThat("The total time should be scaled", scaled.totalTime(),
+                closeTo(original.totalTime() * factor, MathUtils.getFloatCompareThreshold()));
+        double dt = original.totalTime() / 100;
+        for (int i = 0; i <= 100; i++) {
+            BasicMoment m0 = original.get(dt * i);
+            BasicMoment m1 = scaled.get(dt * i * factor);
+
+            assertThat("Position should be the same in both trajectories", m1.getPosition(),
+                    closeTo(m0.getPosition(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Velocity should be divided by the factor", m1.getVelocity(),
+                    closeTo(m0.getVelocity() / factor, MathUtils.getFloatCompareThreshold()));
+            assertThat("Acceleration should be divided by the square of the factor", m1.getAcceleration(),
+                    closeTo(m0.getAcceleration() / factor / factor, MathUtils.getFloatCompareThreshold()));
+            assertThat("Heading should be the same in both trajectories", m1.getHeading(),
+                    closeTo(m0.getHeading(), MathUtils.getFloatCompareThreshold()));
+        }
+
+        try {
+            original.timeScaled(0);
+            fail("The factor must be positive");
+        } catch (IllegalArgumentException e) {
+            // Expected
+        }
+
+        original.close();
+        scaled.close();
+    }
+
+    /**
+     * Performs tests on {@link BasicTrajectory#subtrajectory(double, double)}.
+     * 
+     * This test generates a {@link BasicTrajectory} and takes the part of it
+     * between two random times. It then loops through 100 different points in time
+     * and verifies that the subtrajectory is the original trajectory shifted back
+     * in time and distance, and that its moments start and end at the times.
+     */
+    @Test
+    public void testBasicTrajectorySubtrajectory() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, false);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        BasicTrajectory original = new BasicTrajectory(specs, params);
+        double t0 = helper.getDouble("t0", 0, original.totalTime() / 2);
+        double t1 = helper.getDouble("t1", t0 + original.totalTime() / 4, original.totalTime());
+        BasicTrajectory sub = original.subtrajectory(t0, t1);
+
+        assertThat("The total time should be the length of the window", sub.totalTime(),
+                closeTo(t1 - t0, MathUtils.getFloatCompareThreshold()));
+        double start = original.get(t0).getPosition();
+        double dt = (t1 - t0) / 100;
+        for (int i = 0; i <= 100; i++) {
+            BasicMoment m0 = original.get(t0 + dt * i);
+            BasicMoment m1 = sub.get(dt * i);
+
+            assertThat("Time should start at the beginning of the window", m1.getTime(),
+                    closeTo(dt * i, MathUtils.getFloatCompareThreshold()));
+            assertThat("Position should start at the beginning of the window", m1.getPosition(),
+                    closeTo(m0.getPosition() - start, MathUtils.getFloatCompareThreshold()));
+            assertThat("Velocity should be the same in both trajectories", m1.getVelocity(),
+                    closeTo(m0.getVelocity(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Heading should be the same in both trajectories", m1.getHeading(),
+                    closeTo(m0.getHeading(), MathUtils.getFloatCompareThreshold()));
+        }
+
+        BasicMoment[] moments = sub.getMoments();
+        assertThat("The first moment should be at the start of the window", moments[0].getTime(),
+                closeTo(0, MathUtils.getFloatCompareThreshold()));
+        assertThat("The last moment should be at the end of the window", moments[moments.length - 1].getTime(),
+                closeTo(t1 - t0, MathUtils.getFloatCompareThreshold()));
+
+        try {
+            original.subtrajectory(t1, t0);
+            fail("The window must not be empty");
+        } catch (IllegalArgumentException e) {
+            // Expected
+        }
+
+        original.close();
+        sub.close();
+    }
 }
@@ -0,0 +1,214 @@
+package com.arctos6135.robotpathfinder.tests.core.trajectory;
+
+import static org.hamcrest.Matchers.closeTo;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertSame;
+import static org.junit.Assert.assertThat;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.TimeoutException;
+
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+import com.arctos6135.robotpathfinder.core.Waypoint;
+import com.arctos6135.robotpathfinder.core.trajectory.BasicTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.GenerationHandle;
+import com.arctos6135.robotpathfinder.core.trajectory.GenerationSlot;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.TrajectoryGenerationException;
+import com.arctos6135.robotpathfinder.tests.TestHelper;
+
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TestName;
+
+/**
+ * This class contains tests for {@link GenerationHandle}.
+ *
+ * @author Tyler Tian
+ */
+public class GenerationHandleTest {
+
+    @Rule
+    public TestName testName = new TestName();
+
+    /**
+     * Tests that a {@link TankDriveTrajectory} generated in the background is the
+     * same as one generated directly.
+     */
+    @Test
+    public void testGenerateAsyncTank() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        TankDriveTrajectory expected;
+        try {
+            expected = new TankDriveTrajectory(specs, params);
+        } catch (TrajectoryGenerationException e) {
+            helper.logMessage("Warning: TrajectoryGenerationException was thrown! Exiting test...");
+            return;
+        }
+
+        GenerationHandle<TankDriveTrajectory> handle = TankDriveTrajectory.generateAsync(specs, params);
+        TankDriveTrajectory actual = handle.get();
+        assertEquals(GenerationHandle.Status.DONE, handle.getStatus());
+        assertTrue(handle.isDone());
+        // The same trajectory should be returned every time
+        assertSame(actual, handle.get());
+
+        assertThat(actual.totalTime(), closeTo(expected.totalTime(), 1e-10));
+        double dt = expected.totalTime() / 100;
+        for (int i = 0; i <= 100; i++) {
+            TankDriveMoment m0 = expected.get(dt * i);
+            TankDriveMoment m1 = actual.get(dt * i);
+            assertThat(m1.getLeftPosition(), closeTo(m0.getLeftPosition(), 1e-10));
+            assertThat(m1.getRightPosition(), closeTo(m0.getRightPosition(), 1e-10));
+            assertThat(m1.getLeftVelocity(), closeTo(m0.getLeftVelocity(), 1e-10));
+            assertThat(m1.getRightVelocity(), closeTo(m0.getRightVelocity(), 1e-10));
+        }
+
+        handle.close();
+        // The trajectory should still be usable after the handle is freed
+        actual.get(0);
+        actual.close();
+        expected.close();
+    }
+
+    /**
+     * Tests that generation errors are reported through the handle and the
+     * future.
+     */
+    @Test
+    public void testGenerateAsyncFailure() throws InterruptedException, TimeoutException {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, false);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper,
+                TrajectoryTestingUtils.getRandomWaypoints(helper, 3));
+
+        // Same as in BasicTrajectoryTest
+        double midVel = helper.getDouble("midVel", specs.getMaxVelocity() * 1.1, specs.getMaxVelocity() * 5);
+        Waypoint mid = params.waypoints[1];
+        params.waypoints[1] = new Waypoint(mid.getX(), mid.getY(), mid.getHeading(), midVel);
+
+        GenerationHandle<BasicTrajectory> handle = BasicTrajectory.generateAsync(specs, params);
+        CompletableFuture<BasicTrajectory> future = handle.toFuture();
+        try {
+            future.get(10, TimeUnit.SECONDS);
+            fail("The future should have completed exceptionally");
+        } catch (ExecutionException e) {
+            assertTrue(e.getCause() instanceof TrajectoryGenerationException);
+        }
+        assertEquals(GenerationHandle.Status.FAILED, handle.getStatus());
+
+        try {
+            handle.get();
+            fail("get() should have thrown");
+        } catch (TrajectoryGenerationException e) {
+            // Expected
+        }
+        handle.close();
+    }
+
+    /**
+     * Tests that a trajectory can be cancelled while it is being generated.
+     */
+    @Test
+    public void testCancel() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        // Make sure it takes long enough to be cancelled
+        params.sampleCount = 5000000;
+
+        GenerationHandle<TankDriveTrajectory> handle = TankDriveTrajectory.generateAsync(specs, params);
+        assertTrue(handle.cancel());
+        // Should not take anywhere near as long as the whole generation
+        assertTrue(handle.await(1));
+        assertEquals(GenerationHandle.Status.CANCELLED, handle.getStatus());
+        assertFalse(handle.cancel());
+
+        try {
+            handle.get();
+            fail("get() should have thrown");
+        } catch (CancellationException e) {
+            // Expected
+        }
+        handle.close();
+    }
+
+    /**
+     * Tests that a generation always ends up cancelled when
+     * {@link GenerationHandle#cancel()} returns true, and never does when it
+     * returns false, no matter when it is called.
+     */
+    @Test
+    public void testCancelResult() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        // Short enough that some of the generations finish before they are cancelled
+        params.sampleCount = 2000;
+
+        for (int i = 0; i < 50; i++) {
+            GenerationHandle<TankDriveTrajectory> handle = TankDriveTrajectory.generateAsync(specs, params);
+            boolean cancelled = handle.cancel();
+            handle.await();
+            if (cancelled) {
+                assertEquals(GenerationHandle.Status.CANCELLED, handle.getStatus());
+            } else {
+                assertTrue(handle.getStatus() != GenerationHandle.Status.CANCELLED);
+            }
+            handle.close();
+        }
+    }
+
+    /**
+     * Tests that submitting to a {@link GenerationSlot} cancels the trajectory
+     * that was submitted before.
+     */
+    @Test
+    public void testGenerationSlot() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, false);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        params.sampleCount = 5000000;
+
+        try (GenerationSlot<BasicTrajectory> slot = new GenerationSlot<>(BasicTrajectory::generateAsync)) {
+            GenerationHandle<BasicTrajectory> first = slot.submit(specs, params);
+            params.sampleCount = 100;
+            GenerationHandle<BasicTrajectory> second = slot.submit(specs, params);
+            assertSame(second, slot.current());
+
+            // The first handle was freed by the slot
+            try {
+                first.getStatus();
+                fail("The first handle should have been freed");
+            } catch (IllegalStateException e) {
+                // Expected
+            }
+
+            BasicTrajectory trajectory;
+            try {
+                trajectory = second.get();
+            } catch (TrajectoryGenerationException e) {
+                helper.logMessage("Warning: TrajectoryGenerationException was thrown! Exiting test...");
+                return;
+            }
+            assertEquals(100, trajectory.getMoments().length);
+            trajectory.close();
+        }
+    }
+}
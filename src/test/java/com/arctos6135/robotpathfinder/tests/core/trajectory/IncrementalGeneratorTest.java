@@ -0,0 +1,369 @@
+package com.arctos6135.robotpathfinder.tests.core.trajectory;
+
+import static org.hamcrest.Matchers.closeTo;
+import static org.hamcrest.Matchers.greaterThan;
+import static org.hamcrest.Matchers.greaterThanOrEqualTo;
+import static org.hamcrest.Matchers.lessThan;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertSame;
+import static org.junit.Assert.assertThat;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+import com.arctos6135.robotpathfinder.core.PathType;
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+import com.arctos6135.robotpathfinder.core.Waypoint;
+import com.arctos6135.robotpathfinder.core.trajectory.BasicMoment;
+import com.arctos6135.robotpathfinder.core.trajectory.BasicTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.IncrementalGenerator;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.TrajectoryGenerationException;
+import com.arctos6135.robotpathfinder.tests.TestHelper;
+
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TestName;
+
+/**
+ * This class contains tests for {@link IncrementalGenerator}.
+ *
+ * @author Tyler Tian
+ */
+public class IncrementalGeneratorTest {
+
+    @Rule
+    public TestName testName = new TestName();
+
+    /**
+     * Tests that a {@link TankDriveTrajectory} generated in steps is the same as
+     * one generated directly.
+     */
+    @Test
+    public void testGenerateIncrementalTank() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        TankDriveTrajectory expected;
+        try {
+            expected = new TankDriveTrajectory(specs, params);
+        } catch (TrajectoryGenerationException e) {
+            helper.logMessage("Warning: TrajectoryGenerationException was thrown! Exiting test...");
+            return;
+        }
+
+        IncrementalGenerator<TankDriveTrajectory> generator = TankDriveTrajectory.generateIncremental(specs,
+                params);
+        try {
+            generator.get();
+            fail("get() should have thrown before the trajectory is done");
+        } catch (IllegalStateException e) {
+            // Expected
+        }
+
+        // With no budget, every step only processes a few samples
+        double progress = 0;
+        while (!generator.step(0)) {
+            assertFalse(generator.isDone());
+            assertThat(generator.getProgress(), greaterThanOrEqualTo(progress));
+            progress = generator.getProgress();
+        }
+        assertTrue(generator.isDone());
+        assertEquals(1.0, generator.getProgress(), 0);
+
+        TankDriveTrajectory actual = generator.get();
+        // The same trajectory should be returned every time
+        assertSame(actual, generator.get());
+
+        // Both are generated by the same code, so they should be exactly the same
+        assertEquals(expected.totalTime(), actual.totalTime(), 0);
+        double dt = expected.totalTime() / 100;
+        for (int i = 0; i <= 100; i++) {
+            TankDriveMoment m0 = expected.get(dt * i);
+            TankDriveMoment m1 = actual.get(dt * i);
+            assertThat(m1.getLeftPosition(), closeTo(m0.getLeftPosition(), 1e-10));
+            assertThat(m1.getRightPosition(), closeTo(m0.getRightPosition(), 1e-10));
+            assertThat(m1.getLeftVelocity(), closeTo(m0.getLeftVelocity(), 1e-10));
+            assertThat(m1.getRightVelocity(), closeTo(m0.getRightVelocity(), 1e-10));
+        }
+
+        generator.close();
+        // The trajectory should still be usable after the generator is freed
+        actual.get(0);
+        actual.close();
+        expected.close();
+    }
+
+    /**
+     * Tests that a {@link BasicTrajectory} generated in steps is the same as one
+     * generated directly.
+     */
+    @Test
+    public void testGenerateIncrementalBasic() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, false);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        BasicTrajectory expected;
+        try {
+            expected = new BasicTrajectory(specs, params);
+        } catch (TrajectoryGenerationException e) {
+            helper.logMessage("Warning: TrajectoryGenerationException was thrown! Exiting test...");
+            return;
+        }
+
+        IncrementalGenerator<BasicTrajectory> generator = BasicTrajectory.generateIncremental(specs, params);
+        while (!generator.step(0.0001)) {
+        }
+        BasicTrajectory actual = generator.get();
+
+        assertEquals(expected.totalTime(), actual.totalTime(), 0);
+        double dt = expected.totalTime() / 100;
+        for (int i = 0; i <= 100; i++) {
+            BasicMoment m0 = expected.get(dt * i);
+            BasicMoment m1 = actual.get(dt * i);
+            assertThat(m1.getPosition(), closeTo(m0.getPosition(), 1e-10));
+            assertThat(m1.getVelocity(), closeTo(m0.getVelocity(), 1e-10));
+            assertThat(m1.getAcceleration(), closeTo(m0.getAcceleration(), 1e-10));
+        }
+
+        generator.close();
+        actual.close();
+        expected.close();
+    }
+
+    /**
+     * Tests that generation errors are thrown by {@link IncrementalGenerator#step(double)},
+     * and keep being thrown after.
+     */
+    @Test
+    public void testGenerateIncrementalFailure() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, false);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper,
+                TrajectoryTestingUtils.getRandomWaypoints(helper, 3));
+
+        // Same as in BasicTrajectoryTest
+        double midVel = helper.getDouble("midVel", specs.getMaxVelocity() * 1.1, specs.getMaxVelocity() * 5);
+        Waypoint mid = params.waypoints[1];
+        params.waypoints[1] = new Waypoint(mid.getX(), mid.getY(), mid.getHeading(), midVel);
+
+        IncrementalGenerator<BasicTrajectory> generator = BasicTrajectory.generateIncremental(specs, params);
+        try {
+            while (!generator.step(0.001)) {
+            }
+            fail("step() should have thrown");
+        } catch (TrajectoryGenerationException e) {
+            // Expected
+        }
+        try {
+            generator.step(0.001);
+            fail("step() should have thrown again");
+        } catch (TrajectoryGenerationException e) {
+            // Expected
+        }
+        assertFalse(generator.isDone());
+        generator.close();
+    }
+
+    /**
+     * Tests that {@link IncrementalGenerator#step(double)} can keep being called
+     * once the trajectory is done, and after it was retrieved, like it is in a
+     * robot loop.
+     */
+    @Test
+    public void testStepAfterDone() {
+        RobotSpecs specs = new RobotSpecs(3, 2, 1);
+        TrajectoryParams params = new TrajectoryParams();
+        params.waypoints = new Waypoint[] { new Waypoint(0, 0, 0), new Waypoint(10, 5, 0), };
+        params.alpha = 10;
+        params.sampleCount = 500;
+        params.pathType = PathType.QUINTIC_HERMITE;
+
+        IncrementalGenerator<BasicTrajectory> generator = BasicTrajectory.generateIncremental(specs, params);
+        while (!generator.step(0.001)) {
+        }
+        for (int i = 0; i < 5; i++) {
+            assertTrue(generator.step(0.001));
+        }
+        BasicTrajectory trajectory = generator.get();
+        for (int i = 0; i < 5; i++) {
+            assertTrue(generator.step(0.001));
+        }
+        assertSame(trajectory, generator.get());
+        generator.close();
+        trajectory.close();
+
+        IncrementalGenerator<BasicTrajectory> streaming = BasicTrajectory.generateStreaming(specs, params);
+        while (!streaming.step(0.001)) {
+        }
+        trajectory = streaming.get();
+        for (int i = 0; i < 5; i++) {
+            assertTrue(streaming.step(0.001));
+        }
+        assertEquals(params.sampleCount, trajectory.getMoments().length);
+        streaming.close();
+        trajectory.close();
+    }
+
+    /**
+     * Tests that a streaming {@link TankDriveTrajectory} is the same as one
+     * generated directly, and that every moment is already final when it becomes
+     * available.
+     */
+    @Test
+    public void testGenerateStreamingTank() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        TankDriveTrajectory expected;
+        try {
+            expected = new TankDriveTrajectory(specs, params);
+        } catch (TrajectoryGenerationException e) {
+            helper.logMessage("Warning: TrajectoryGenerationException was thrown! Exiting test...");
+            return;
+        }
+
+        IncrementalGenerator<TankDriveTrajectory> generator = TankDriveTrajectory.generateStreaming(specs, params);
+        assertTrue(generator.isStreaming());
+        try {
+            generator.get();
+            fail("get() should have thrown before any moments are available");
+        } catch (IllegalStateException e) {
+            // Expected
+        }
+
+        double availableTime = 0;
+        while (!generator.step(0)) {
+            assertThat(generator.getAvailableTime(), greaterThanOrEqualTo(availableTime));
+            availableTime = generator.getAvailableTime();
+            if (generator.getAvailableCount() == 0) {
+                continue;
+            }
+
+            // Everything that is available should already be the same as in the finished trajectory
+            TankDriveTrajectory partial = generator.get();
+            assertEquals(availableTime, partial.totalTime(), 0);
+            for (int i = 0; i <= 10; i++) {
+                TankDriveMoment m0 = expected.get(availableTime * i / 10);
+                TankDriveMoment m1 = partial.get(availableTime * i / 10);
+                assertThat(m1.getLeftVelocity(), closeTo(m0.getLeftVelocity(), 1e-10));
+                assertThat(m1.getRightVelocity(), closeTo(m0.getRightVelocity(), 1e-10));
+            }
+        }
+
+        TankDriveTrajectory actual = generator.get();
+        assertEquals(expected.totalTime(), actual.totalTime(), 0);
+        assertEquals(expected.totalTime(), generator.getAvailableTime(), 0);
+        double dt = expected.totalTime() / 100;
+        for (int i = 0; i <= 100; i++) {
+            TankDriveMoment m0 = expected.get(dt * i);
+            TankDriveMoment m1 = actual.get(dt * i);
+            assertThat(m1.getLeftPosition(), closeTo(m0.getLeftPosition(), 1e-10));
+            assertThat(m1.getRightPosition(), closeTo(m0.getRightPosition(), 1e-10));
+            assertThat(m1.getLeftVelocity(), closeTo(m0.getLeftVelocity(), 1e-10));
+            assertThat(m1.getRightVelocity(), closeTo(m0.getRightVelocity(), 1e-10));
+        }
+
+        generator.close();
+        actual.close();
+        expected.close();
+    }
+
+    /**
+     * Tests that every moment of a streaming {@link TankDriveTrajectory} is the
+     * same as the moment of one generated directly as soon as it is available,
+     * including the accelerations of the last one.
+     */
+    @Test
+    public void testGenerateStreamingTankMoments() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        TankDriveTrajectory expected;
+        try {
+            expected = new TankDriveTrajectory(specs, params);
+        } catch (TrajectoryGenerationException e) {
+            helper.logMessage("Warning: TrajectoryGenerationException was thrown! Exiting test...");
+            return;
+        }
+        TankDriveMoment[] expectedMoments = expected.getMoments();
+
+        IncrementalGenerator<TankDriveTrajectory> generator = TankDriveTrajectory.generateStreaming(specs, params);
+        boolean done = false;
+        while (!done) {
+            done = generator.step(0);
+            if (generator.getAvailableCount() == 0) {
+                continue;
+            }
+
+            // The moments are retrieved again as the trajectory grows, without clearing the cache
+            TankDriveMoment[] moments = generator.get().getMoments();
+            assertEquals(generator.getAvailableCount(), moments.length);
+            for (int i = 0; i < moments.length; i++) {
+                TankDriveMoment m0 = expectedMoments[i];
+                TankDriveMoment m1 = moments[i];
+                assertEquals(m0.getTime(), m1.getTime(), 0);
+                assertEquals(m0.getLeftPosition(), m1.getLeftPosition(), 0);
+                assertEquals(m0.getRightPosition(), m1.getRightPosition(), 0);
+                assertEquals(m0.getLeftVelocity(), m1.getLeftVelocity(), 0);
+                assertEquals(m0.getRightVelocity(), m1.getRightVelocity(), 0);
+                assertEquals(m0.getLeftAcceleration(), m1.getLeftAcceleration(), 0);
+                assertEquals(m0.getRightAcceleration(), m1.getRightAcceleration(), 0);
+            }
+        }
+        TankDriveTrajectory actual = generator.get();
+        assertEquals(expectedMoments.length, actual.getMoments().length);
+
+        generator.close();
+        actual.close();
+        expected.close();
+    }
+
+    /**
+     * Tests that a streaming generator makes the start of a long
+     * {@link BasicTrajectory} available before it is done.
+     */
+    @Test
+    public void testGenerateStreamingBasicEarly() {
+        RobotSpecs specs = new RobotSpecs(3, 2, 1);
+        TrajectoryParams params = new TrajectoryParams();
+        params.waypoints = new Waypoint[] { new Waypoint(0, 0, 0), new Waypoint(40, 10, 0), };
+        params.alpha = 40;
+        params.sampleCount = 5000;
+        params.pathType = PathType.QUINTIC_HERMITE;
+
+        IncrementalGenerator<BasicTrajectory> generator = BasicTrajectory.generateStreaming(specs, params);
+        while (generator.getAvailableCount() == 0) {
+            assertFalse("The whole trajectory was generated before any moments were available",
+                    generator.step(0));
+        }
+        assertFalse(generator.isDone());
+        assertThat(generator.getAvailableCount(), lessThan(params.sampleCount));
+        assertThat(generator.getAvailableTime(), greaterThan(0.0));
+
+        BasicTrajectory trajectory = generator.get();
+        double availableTime = generator.getAvailableTime();
+        assertEquals(generator.getAvailableCount(), trajectory.getMoments().length);
+        while (!generator.step(0.001)) {
+        }
+        assertSame(trajectory, generator.get());
+        assertEquals(params.sampleCount, generator.getAvailableCount());
+        assertThat(trajectory.totalTime(), greaterThan(availableTime));
+        // The moments cached before it was done are not returned again
+        assertEquals(params.sampleCount, trajectory.getMoments().length);
+
+        generator.close();
+        trajectory.close();
+    }
+}
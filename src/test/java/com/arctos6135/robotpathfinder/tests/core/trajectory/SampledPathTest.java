@@ -0,0 +1,134 @@
+package com.arctos6135.robotpathfinder.tests.core.trajectory;
+
+import static org.hamcrest.Matchers.closeTo;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertThat;
+import static org.junit.Assert.fail;
+
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+import com.arctos6135.robotpathfinder.core.trajectory.BasicMoment;
+import com.arctos6135.robotpathfinder.core.trajectory.BasicTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.SampledPath;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.TrajectoryGenerationException;
+import com.arctos6135.robotpathfinder.tests.TestHelper;
+
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TestName;
+
+/**
+ * This class contains tests for {@link SampledPath}.
+ *
+ * @author Tyler Tian
+ */
+public class SampledPathTest {
+
+    @Rule
+    public TestName testName = new TestName();
+
+    /**
+     * Tests that {@link TankDriveTrajectory} objects generated from one
+     * {@link SampledPath} with different specs are the same as ones generated
+     * directly.
+     */
+    @Test
+    public void testSampledTank() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        try (SampledPath path = new SampledPath(params, specs.getBaseWidth())) {
+            for (int i = 0; i < 3; i++) {
+                // Each preset is slower than the last, with the same base width
+                RobotSpecs preset = new RobotSpecs(specs.getMaxVelocity() / (i + 1),
+                        specs.getMaxAcceleration() / (i + 1), specs.getBaseWidth());
+
+                TankDriveTrajectory expected;
+                try {
+                    expected = new TankDriveTrajectory(preset, params);
+                } catch (TrajectoryGenerationException e) {
+                    helper.logMessage("Warning: TrajectoryGenerationException was thrown! Skipping preset...");
+                    continue;
+                }
+                TankDriveTrajectory actual = new TankDriveTrajectory(preset, path);
+
+                // Both are generated by the same code, so they should be exactly the same
+                assertEquals(expected.totalTime(), actual.totalTime(), 0);
+                double dt = expected.totalTime() / 100;
+                for (int j = 0; j <= 100; j++) {
+                    TankDriveMoment m0 = expected.get(dt * j);
+                    TankDriveMoment m1 = actual.get(dt * j);
+                    assertThat(m1.getLeftPosition(), closeTo(m0.getLeftPosition(), 1e-10));
+                    assertThat(m1.getRightPosition(), closeTo(m0.getRightPosition(), 1e-10));
+                    assertThat(m1.getLeftVelocity(), closeTo(m0.getLeftVelocity(), 1e-10));
+                    assertThat(m1.getRightVelocity(), closeTo(m0.getRightVelocity(), 1e-10));
+                }
+
+                expected.close();
+                actual.close();
+            }
+        }
+    }
+
+    /**
+     * Tests that {@link BasicTrajectory} objects generated from one
+     * {@link SampledPath} with different specs are the same as ones generated
+     * directly, and can still be used after the path is freed.
+     */
+    @Test
+    public void testSampledBasic() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, false);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        SampledPath path = new SampledPath(params);
+        RobotSpecs slow = new RobotSpecs(specs.getMaxVelocity() / 2, specs.getMaxAcceleration() / 2);
+        BasicTrajectory expected;
+        try {
+            expected = new BasicTrajectory(slow, params);
+        } catch (TrajectoryGenerationException e) {
+            helper.logMessage("Warning: TrajectoryGenerationException was thrown! Exiting test...");
+            path.close();
+            return;
+        }
+        BasicTrajectory actual = new BasicTrajectory(slow, path);
+        path.close();
+
+        assertEquals(expected.totalTime(), actual.totalTime(), 0);
+        double dt = expected.totalTime() / 100;
+        for (int i = 0; i <= 100; i++) {
+            BasicMoment m0 = expected.get(dt * i);
+            BasicMoment m1 = actual.get(dt * i);
+            assertThat(m1.getPosition(), closeTo(m0.getPosition(), 1e-10));
+            assertThat(m1.getVelocity(), closeTo(m0.getVelocity(), 1e-10));
+            assertThat(m1.getAcceleration(), closeTo(m0.getAcceleration(), 1e-10));
+        }
+
+        expected.close();
+        actual.close();
+    }
+
+    /**
+     * Tests that a {@link SampledPath} for tank drive cannot be used with specs
+     * that have a different base width.
+     */
+    @Test
+    public void testSampledBaseWidthMismatch() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        try (SampledPath path = new SampledPath(params, specs.getBaseWidth() * 2)) {
+            new TankDriveTrajectory(specs, path);
+            fail("The base width of the specs is different from the path's");
+        } catch (IllegalArgumentException e) {
+            // Expected
+        }
+    }
+}
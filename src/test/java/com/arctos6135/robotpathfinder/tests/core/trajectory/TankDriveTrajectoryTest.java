@@ -1,13 +1,14 @@
 package com.arctos6135.robotpathfinder.tests.core.trajectory;
 
 import static org.hamcrest.Matchers.closeTo;
+import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertThat;
 import static org.junit.Assert.fail;
 
 import com.arctos6135.robotpathfinder.core.RobotSpecs;
 import com.arctos6135.robotpathfinder.core.TrajectoryParams;
 import com.arctos6135.robotpathfinder.core.Waypoint;
-import com.arctos6135.robotpathfinder.core.trajectory.BasicTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.GeneratorType;
 import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
 import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
 import com.arctos6135.robotpathfinder.core.trajectory.TrajectoryGenerationException;
@@ -34,9 +35,6 @@ public class TankDriveTrajectoryTest {
      * This test generates a {@link TankDriveTrajectory} and loops through all its
      * Moments, ensuring that the absolute value of the velocity never exceeds the
      * limit.
-     * 
-     * Note that unlike the test for {@link BasicTrajectory}, this does not test for
-     * acceleration, as it cannot be limited at turns by design.
      */
     @Test
     public void testVelocityLimitTank() {
@@ -58,6 +56,107 @@ public class TankDriveTrajectoryTest {
         trajectory.close();
     }
 
+    /**
+     * Performs acceleration limit testing on a {@link TankDriveTrajectory}.
+     * 
+     * This test generates a {@link TankDriveTrajectory} with the default generator
+     * and loops through all its Moments, ensuring that the absolute value of the
+     * acceleration of both wheels never exceeds the limit. The acceleration is
+     * compared relative to the limit, since it is computed from differences in
+     * time.
+     */
+    @Test
+    public void testAccelerationLimitTank() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        TankDriveTrajectory trajectory = new TankDriveTrajectory(specs, params);
+
+        for (TankDriveMoment m : trajectory.getMoments()) {
+            if (MathUtils.floatGt(Math.abs(m.getLeftAcceleration()) / specs.getMaxAcceleration(), 1)) {
+                fail("The left wheel of the TankDriveTrajectory exceeded the acceleration limit at time "
+                        + m.getTime());
+            }
+            if (MathUtils.floatGt(Math.abs(m.getRightAcceleration()) / specs.getMaxAcceleration(), 1)) {
+                fail("The right wheel of the TankDriveTrajectory exceeded the acceleration limit at time "
+                        + m.getTime());
+            }
+        }
+        trajectory.close();
+    }
+
+    /**
+     * Performs voltage limit testing on a {@link TankDriveTrajectory}.
+     * 
+     * This test generates a {@link TankDriveTrajectory} with a random voltage limit
+     * and loops through all its Moments, ensuring that the voltage predicted for
+     * both wheels never exceeds the limit.
+     */
+    @Test
+    public void testVoltageLimitTank() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        specs.setVoltageLimit(helper.getDouble("maxVoltage", 1, 24), helper.getDouble("kV", 10),
+                helper.getDouble("kA", 10));
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+
+        TankDriveTrajectory trajectory = new TankDriveTrajectory(specs, params);
+
+        for (TankDriveMoment m : trajectory.getMoments()) {
+            double leftVoltage = specs.getKV() * m.getLeftVelocity() + specs.getKA() * m.getLeftAcceleration();
+            double rightVoltage = specs.getKV() * m.getRightVelocity() + specs.getKA() * m.getRightAcceleration();
+            if (MathUtils.floatGt(Math.abs(leftVoltage) / specs.getMaxVoltage(), 1)) {
+                fail("The left wheel of the TankDriveTrajectory exceeded the voltage limit at time " + m.getTime());
+            }
+            if (MathUtils.floatGt(Math.abs(rightVoltage) / specs.getMaxVoltage(), 1)) {
+                fail("The right wheel of the TankDriveTrajectory exceeded the voltage limit at time " + m.getTime());
+            }
+        }
+        trajectory.close();
+    }
+
+    /**
+     * Performs velocity and acceleration limit testing on a
+     * {@link TankDriveTrajectory} generated with
+     * {@link GeneratorType#TIME_OPTIMAL}.
+     * 
+     * This test generates a {@link TankDriveTrajectory} and loops through all its
+     * Moments, ensuring that the absolute values of the velocity and acceleration
+     * of both wheels never exceed the limits. The acceleration is compared relative
+     * to the limit, since it is computed from differences in time.
+     */
+    @Test
+    public void testTimeOptimalLimitsTank() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        params.generatorType = GeneratorType.TIME_OPTIMAL;
+
+        TankDriveTrajectory trajectory = new TankDriveTrajectory(specs, params);
+
+        for (TankDriveMoment m : trajectory.getMoments()) {
+            if (MathUtils.floatGt(Math.abs(m.getLeftVelocity()), specs.getMaxVelocity())) {
+                fail("The left wheel of the TankDriveTrajectory exceeded the velocity limit at time " + m.getTime());
+            }
+            if (MathUtils.floatGt(Math.abs(m.getRightVelocity()), specs.getMaxVelocity())) {
+                fail("The right wheel of the TankDriveTrajectory exceeded the velocity limit at time " + m.getTime());
+            }
+            if (MathUtils.floatGt(Math.abs(m.getLeftAcceleration()) / specs.getMaxAcceleration(), 1)) {
+                fail("The left wheel of the TankDriveTrajectory exceeded the acceleration limit at time "
+                        + m.getTime());
+            }
+            if (MathUtils.floatGt(Math.abs(m.getRightAcceleration()) / specs.getMaxAcceleration(), 1)) {
+                fail("The right wheel of the TankDriveTrajectory exceeded the acceleration limit at time "
+                        + m.getTime());
+            }
+        }
+        trajectory.close();
+    }
+
     /**
      * Performs tests on {@link TankDriveTrajectory#mirrorLeftRight()}.
      * 
@@ -317,4 +416,101 @@ public class TankDriveTrajectoryTest {
 
         traj.close();
     }
+
+    /**
+     * Performs tests on {@link TankDriveTrajectory#timeScaled(double)}.
+     * 
+     * This test generates a {@link TankDriveTrajectory} and scales it by a random
+     * factor. It then verifies that the moments of the scaled trajectory are the
+     * same as the original trajectory's with their times multiplied by the factor,
+     * velocities divided by it, and accelerations divided by its square, and that
+     * the scaled trajectory can still be used after the original is freed.
+     */
+    @Test
+    public void testTankDriveTrajectoryTimeScaled() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        double factor = helper.getDouble("factor", 0.5, 3);
+
+        TankDriveTrajectory original = new TankDriveTrajectory(specs, params);
+        TankDriveTrajectory scaled = original.timeScaled(factor);
+        TankDriveMoment[] moments = original.getMoments();
+        // The moments are shared with the scaled trajectory
+        original.close();
+
+        TankDriveMoment[] scaledMoments = scaled.getMoments();
+        assertEquals("The number of moments should be the same", moments.length, scaledMoments.length);
+        for (int i = 0; i < moments.length; i++) {
+            TankDriveMoment m0 = moments[i];
+            TankDriveMoment m1 = scaledMoments[i];
+
+            assertThat("Time should be multiplied by the factor", m1.getTime(),
+                    closeTo(m0.getTime() * factor, MathUtils.getFloatCompareThreshold()));
+            assertThat("Left position should be the same in both trajectories", m1.getLeftPosition(),
+                    closeTo(m0.getLeftPosition(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Right position should be the same in both trajectories", m1.getRightPosition(),
+                    closeTo(m0.getRightPosition(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Left velocity should be divided by the factor", m1.getLeftVelocity(),
+                    closeTo(m0.getLeftVelocity() / factor, MathUtils.getFloatCompareThreshold()));
+            assertThat("Right velocity should be divided by the factor", m1.getRightVelocity(),
+                    closeTo(m0.getRightVelocity() / factor, MathUtils.getFloatCompareThreshold()));
+            assertThat("Left acceleration should be divided by the square of the factor", m1.getLeftAcceleration(),
+                    closeTo(m0.getLeftAcceleration() / factor / factor, MathUtils.getFloatCompareThreshold()));
+            assertThat("Right acceleration should be divided by the square of the factor",
+                    m1.getRightAcceleration(),
+                    closeTo(m0.getRightAcceleration() / factor / factor, MathUtils.getFloatCompareThreshold()));
+        }
+
+        scaled.close();
+    }
+
+    /**
+     * Performs tests on {@link TankDriveTrajectory#anchoredAt(Waypoint)}.
+     * 
+     * This test generates a {@link TankDriveTrajectory} and anchors it at a random
+     * pose. It then verifies that the new trajectory starts at the pose, and that
+     * the wheels of both trajectories move the same way, with the headings rotated
+     * by the difference between the start headings.
+     */
+    @Test
+    public void testTankDriveTrajectoryAnchoredAt() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs specs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        Waypoint pose = new Waypoint(helper.getDouble("x", -100, 100), helper.getDouble("y", -100, 100),
+                helper.getDouble("heading", -Math.PI, Math.PI));
+
+        TankDriveTrajectory original = new TankDriveTrajectory(specs, params);
+        TankDriveTrajectory anchored = original.anchoredAt(pose);
+
+        Waypoint start = anchored.getPosition(0);
+        assertThat("The x should be the same as the pose's", start.getX(),
+                closeTo(pose.getX(), MathUtils.getFloatCompareThreshold()));
+        assertThat("The y should be the same as the pose's", start.getY(),
+                closeTo(pose.getY(), MathUtils.getFloatCompareThreshold()));
+        assertThat("The heading should be the same as the pose's",
+                MathUtils.restrictAngle(start.getHeading() - pose.getHeading()),
+                closeTo(0, MathUtils.getFloatCompareThreshold()));
+
+        double rotation = pose.getHeading() - original.getPosition(0).getHeading();
+        double dt = original.totalTime() / 100;
+        for (int i = 0; i <= 100; i++) {
+            TankDriveMoment m0 = original.get(dt * i);
+            TankDriveMoment m1 = anchored.get(dt * i);
+
+            assertThat("Left position should be the same in both trajectories", m1.getLeftPosition(),
+                    closeTo(m0.getLeftPosition(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Right velocity should be the same in both trajectories", m1.getRightVelocity(),
+                    closeTo(m0.getRightVelocity(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Heading should be rotated",
+                    MathUtils.restrictAngle(m1.getHeading() - m0.getHeading() - rotation),
+                    closeTo(0, MathUtils.getFloatCompareThreshold()));
+        }
+
+        original.close();
+        anchored.close();
+    }
 }
@@ -2,10 +2,16 @@ package com.arctos6135.robotpathfinder.tests.core.trajectory;
 
 import static org.hamcrest.Matchers.closeTo;
 import static org.hamcrest.Matchers.lessThan;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertThat;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
 
 import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.Waypoint;
 import com.arctos6135.robotpathfinder.core.trajectory.BasicTrajectory;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
 import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
 import com.arctos6135.robotpathfinder.core.trajectory.TrajectoryGenerator;
 import com.arctos6135.robotpathfinder.math.MathUtils;
@@ -111,4 +117,86 @@ public class TrajectoryGeneratorTest {
         traj1.close();
         traj2.close();
     }
+
+    /**
+     * Performs tests on the methods of a {@link TankDriveTrajectory} generated with
+     * {@link TrajectoryGenerator#generateRotationTank(RobotSpecs, double)}.
+     * 
+     * This test generates a turn in place and checks its moments and positions, as
+     * well as the mirrored, retraced and subtrajectory versions of it. Since the
+     * turn has no path, {@link TankDriveTrajectory#getPath()} should throw.
+     */
+    @Test
+    public void testRotationTankMethods() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        double maxV = helper.getDouble("maxV", 1000);
+        double maxA = helper.getDouble("maxA", 1000);
+        double baseWidth = helper.getDouble("baseWidth", 1000);
+        double angle = helper.getDouble("angle", Math.PI / 4, Math.PI);
+
+        RobotSpecs specs = new RobotSpecs(maxV, maxA, baseWidth);
+        TankDriveTrajectory traj = TrajectoryGenerator.generateRotationTank(specs, angle);
+        double end = traj.totalTime();
+        double threshold = MathUtils.getFloatCompareThreshold();
+
+        // Only the start and the end are stored as moments
+        assertEquals(2, traj.getMoments().length);
+        try {
+            traj.getPath();
+            fail("A turn in place should not have a path");
+        } catch (IllegalStateException e) {
+            // Expected
+        }
+        // The robot turns without moving
+        for (double t : new double[] { 0, end / 3, end }) {
+            Waypoint pos = traj.getPosition(t);
+            assertThat(pos.getX(), closeTo(0, threshold));
+            assertThat(pos.getY(), closeTo(0, threshold));
+            assertThat(Math.abs(MathUtils.angleDiff(pos.getHeading(), traj.get(t).getHeading())),
+                    lessThan(threshold));
+        }
+        assertThat(traj.get(end).getLeftPosition(), closeTo(-angle * baseWidth / 2, threshold));
+        assertThat(traj.get(end).getRightPosition(), closeTo(angle * baseWidth / 2, threshold));
+
+        // Mirroring left to right swaps the wheels
+        TankDriveTrajectory mirroredLR = traj.mirrorLeftRight();
+        TankDriveMoment m = mirroredLR.get(end);
+        assertThat(m.getLeftPosition(), closeTo(angle * baseWidth / 2, threshold));
+        assertThat(m.getRightPosition(), closeTo(-angle * baseWidth / 2, threshold));
+        mirroredLR.close();
+
+        // Mirroring front to back drives both wheels the other way, backwards
+        TankDriveTrajectory mirroredFB = traj.mirrorFrontBack();
+        for (double t : new double[] { 0, end / 3, end }) {
+            m = mirroredFB.get(t);
+            assertThat(m.getLeftPosition(), closeTo(-traj.get(t).getLeftPosition(), threshold));
+            assertThat(m.getRightPosition(), closeTo(-traj.get(t).getRightPosition(), threshold));
+            assertTrue(m.getBackwards());
+        }
+        TankDriveTrajectory twice = mirroredFB.mirrorFrontBack();
+        assertThat(Math.abs(MathUtils.angleDiff(twice.get(end).getHeading(), traj.get(end).getHeading())),
+                lessThan(threshold));
+        assertFalse(twice.get(end).getBackwards());
+        mirroredFB.close();
+        twice.close();
+
+        // Retracing turns back to the start
+        TankDriveTrajectory retraced = traj.retrace();
+        assertThat(Math.abs(MathUtils.angleDiff(retraced.get(end).getHeading(), traj.get(0).getHeading())),
+                lessThan(threshold));
+        retraced.close();
+
+        // A subtrajectory starts where the window starts
+        TankDriveTrajectory sub = traj.subtrajectory(end / 4, end / 2);
+        assertThat(sub.totalTime(), closeTo(end / 4, threshold));
+        assertThat(sub.get(0).getLeftPosition(), closeTo(0, threshold));
+        assertThat(Math.abs(MathUtils.angleDiff(sub.get(0).getHeading(), traj.get(end / 4).getHeading())),
+                lessThan(threshold));
+        assertThat(Math.abs(MathUtils.angleDiff(sub.getPosition(end / 4).getHeading(),
+                traj.get(end / 2).getHeading())), lessThan(threshold));
+        sub.close();
+
+        traj.close();
+    }
 }
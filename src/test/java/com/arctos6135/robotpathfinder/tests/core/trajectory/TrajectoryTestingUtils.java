@@ -111,12 +111,16 @@ public final class TrajectoryTestingUtils {
      * @return A random {@link PathType}
      */
     public static PathType getRandomPathType(TestHelper helper) {
-        int type = helper.getInt("pathType", 2);
+        int type = helper.getInt("pathType", 5);
         switch (type) {
         case 0:
             return PathType.BEZIER;
         case 1:
             return PathType.CUBIC_HERMITE;
+        case 3:
+            return PathType.QUINTIC_HERMITE_C2;
+        case 4:
+            return PathType.CLOTHOID;
         case 2:
         default:
             return PathType.QUINTIC_HERMITE;
@@ -1,16 +1,24 @@
 package com.arctos6135.robotpathfinder.tests.follower;
 
 import static org.hamcrest.Matchers.both;
+import static org.hamcrest.Matchers.greaterThan;
 import static org.hamcrest.Matchers.greaterThanOrEqualTo;
 import static org.hamcrest.Matchers.is;
 import static org.hamcrest.Matchers.lessThanOrEqualTo;
 import static org.junit.Assert.assertThat;
 import static org.junit.Assert.fail;
 
+import com.arctos6135.robotpathfinder.core.RobotSpecs;
+import com.arctos6135.robotpathfinder.core.TrajectoryParams;
+import com.arctos6135.robotpathfinder.core.Waypoint;
+import com.arctos6135.robotpathfinder.core.path.PathType;
 import com.arctos6135.robotpathfinder.core.trajectory.Moment;
+import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
 import com.arctos6135.robotpathfinder.follower.Follower;
 import com.arctos6135.robotpathfinder.follower.FollowerRunner;
+import com.arctos6135.robotpathfinder.follower.RealTimeFollowerRunner;
 import com.arctos6135.robotpathfinder.follower.SimpleFollowerRunner;
+import com.arctos6135.robotpathfinder.follower.TankDriveFollower.TankDriveGains;
 import com.arctos6135.robotpathfinder.follower.TimedFollowerRunner;
 
 import org.junit.Test;
@@ -124,4 +132,60 @@ public class FollowerRunnerTest {
     public void testTimedFollowerRunner() {
         testFollowerRunner(new TimedFollowerRunner());
     }
+
+    /**
+     * Tests {@link RealTimeFollowerRunner}.
+     * 
+     * This runs a short trajectory to the end, feeding the runner sensor readings
+     * and polling its commands, and checks that the control loop ran and stopped
+     * the motors once it was done.
+     */
+    @Test
+    public void testRealTimeFollowerRunner() {
+        RobotSpecs robotSpecs = new RobotSpecs(5.0, 10.0, 1.0);
+        TrajectoryParams params = new TrajectoryParams();
+        params.waypoints = new Waypoint[] { new Waypoint(0.0, 0.0, Math.PI / 2),
+                new Waypoint(0.0, 1.0, Math.PI / 2), };
+        params.alpha = 1.0;
+        params.sampleCount = 100;
+        params.pathType = PathType.QUINTIC_HERMITE;
+        TankDriveTrajectory traj = new TankDriveTrajectory(robotSpecs, params);
+
+        try (RealTimeFollowerRunner runner = new RealTimeFollowerRunner(traj,
+                new TankDriveGains(0.2, 0.02, 0, 0, 0, 0))) {
+            traj.free();
+            runner.pushFeedback(Double.NaN, Double.NaN, Double.NaN);
+            runner.start(200);
+            assertThat("The runner should be running after it is started", runner.isRunning(), is(true));
+
+            double[] command = new double[3];
+            int commands = 0;
+            long start = System.nanoTime();
+            while (runner.isRunning()) {
+                if (System.nanoTime() - start > 5000000000L) {
+                    runner.stop();
+                    fail("The runner did not finish within 5s!");
+                }
+                if (runner.pollCommand(command)) {
+                    commands++;
+                }
+                try {
+                    Thread.sleep(1);
+                } catch (InterruptedException e) {
+                    runner.stop();
+                    throw new RuntimeException("Interrupted!", e);
+                }
+            }
+
+            assertThat("The runner should have finished the trajectory", runner.isFinished(), is(true));
+            assertThat("Commands should have been received", commands, greaterThan(0));
+            assertThat("The last command should stop the motors", runner.pollCommand(command), is(true));
+            assertThat(command[0], is(0.0));
+            assertThat(command[1], is(0.0));
+
+            RealTimeFollowerRunner.Statistics stats = runner.getStatistics();
+            assertThat((int) stats.iterations, greaterThanOrEqualTo(commands));
+            assertThat(stats.maxJitter, greaterThanOrEqualTo(stats.meanJitter));
+        }
+    }
 }
@@ -1,23 +1,29 @@
 package com.arctos6135.robotpathfinder.tests.follower;
 
 import static org.hamcrest.Matchers.closeTo;
+import static org.hamcrest.Matchers.equalTo;
 import static org.hamcrest.Matchers.is;
 import static org.hamcrest.Matchers.not;
 import static org.junit.Assert.assertThat;
 
+import java.nio.ByteBuffer;
+
 import com.arctos6135.robotpathfinder.core.RobotSpecs;
 import com.arctos6135.robotpathfinder.core.TrajectoryParams;
 import com.arctos6135.robotpathfinder.core.Waypoint;
 import com.arctos6135.robotpathfinder.core.path.PathType;
 import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
 import com.arctos6135.robotpathfinder.core.trajectory.TankDriveTrajectory;
+import com.arctos6135.robotpathfinder.follower.Followable;
 import com.arctos6135.robotpathfinder.follower.Follower;
 import com.arctos6135.robotpathfinder.follower.TankDriveFollower;
 import com.arctos6135.robotpathfinder.follower.TankDriveFollower.TankDriveGains;
 import com.arctos6135.robotpathfinder.follower.TankDriveFollower.TankDriveRobot;
+import com.arctos6135.robotpathfinder.follower.TelemetryBuffer;
 import com.arctos6135.robotpathfinder.math.MathUtils;
 import com.arctos6135.robotpathfinder.motionprofile.followable.profiles.TrapezoidalTankDriveProfile;
 import com.arctos6135.robotpathfinder.tests.TestHelper;
+import com.arctos6135.robotpathfinder.tests.core.trajectory.TrajectoryTestingUtils;
 
 import org.junit.Rule;
 import org.junit.Test;
@@ -246,4 +252,251 @@ public class FollowerTest {
         assertThat("The follower's motor output should be as expected", motor.value,
                 closeTo(profile.get(checkTime).getLeftAcceleration(), MathUtils.getFloatCompareThreshold()));
     }
+
+    /**
+     * Performs tests on the native control law of {@link TankDriveFollower}.
+     * 
+     * This test creates two {@link TankDriveFollower}s that follow the same
+     * trajectory, one of them directly (which uses the native control law) and
+     * the other through a wrapper {@link Followable} (which uses the Java control
+     * law). It then feeds both of them the same random sensor readings, and
+     * asserts that their outputs and errors are the same.
+     */
+    @Test
+    public void testTankDriveFollowerNative() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        double startTime = helper.getDouble("startTime", 1000);
+
+        RobotSpecs robotSpecs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        TankDriveTrajectory traj = new TankDriveTrajectory(robotSpecs, params);
+        Followable<TankDriveMoment> wrapper = new Followable<TankDriveMoment>() {
+            @Override
+            public TankDriveMoment get(double t) {
+                return traj.get(t);
+            }
+
+            @Override
+            public double totalTime() {
+                return traj.totalTime();
+            }
+        };
+
+        FakeTimer timer = new FakeTimer();
+        FakeEncoder lEncoder = new FakeEncoder();
+        FakeEncoder rEncoder = new FakeEncoder();
+        FakeGyro gyro = new FakeGyro();
+        FakeMotor lMotor = new FakeMotor();
+        FakeMotor rMotor = new FakeMotor();
+        FakeMotor lMotorJava = new FakeMotor();
+        FakeMotor rMotorJava = new FakeMotor();
+        TankDriveGains gains = new TankDriveGains(helper.getDouble("kV", 1), helper.getDouble("kA", 1),
+                helper.getDouble("kP", 1), helper.getDouble("kI", 1), helper.getDouble("kD", 1),
+                helper.getDouble("kDP", 1));
+        TankDriveFollower follower = new TankDriveFollower(traj,
+                new TankDriveRobot(lMotor, rMotor, lEncoder, rEncoder, timer, gyro), gains);
+        TankDriveFollower javaFollower = new TankDriveFollower(wrapper,
+                new TankDriveRobot(lMotorJava, rMotorJava, lEncoder, rEncoder, timer, gyro), gains);
+
+        timer.value = startTime;
+        follower.initialize();
+        javaFollower.initialize();
+        for (int i = 1; i <= 20; i++) {
+            timer.value = startTime + traj.totalTime() * i / 20;
+            lEncoder.value = helper.getDouble("lPos" + i, -1000, 1000);
+            rEncoder.value = helper.getDouble("rPos" + i, -1000, 1000);
+            gyro.value = helper.getDouble("direction" + i, -Math.PI, Math.PI);
+            follower.run();
+            javaFollower.run();
+
+            assertThat("Left outputs should be the same", lMotor.value,
+                    closeTo(lMotorJava.value, MathUtils.getFloatCompareThreshold()));
+            assertThat("Right outputs should be the same", rMotor.value,
+                    closeTo(rMotorJava.value, MathUtils.getFloatCompareThreshold()));
+            assertThat("Left errors should be the same", follower.lastLeftError(),
+                    closeTo(javaFollower.lastLeftError(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Right integrals should be the same", follower.lastRightIntegral(),
+                    closeTo(javaFollower.lastRightIntegral(), MathUtils.getFloatCompareThreshold()));
+            assertThat("Directional errors should be the same", follower.lastDirectionalError(),
+                    closeTo(javaFollower.lastDirectionalError(), MathUtils.getFloatCompareThreshold()));
+        }
+
+        traj.free();
+    }
+
+    /**
+     * Performs tests on changing the gains of a {@link TankDriveFollower} while it
+     * is running.
+     * 
+     * This test creates two {@link TankDriveFollower}s like
+     * {@link #testTankDriveFollowerNative()}, and changes the gains of both of them
+     * between iterations through every setter. Since the Java control law always
+     * uses the current gains, the outputs of the native control law should still
+     * be the same as its outputs.
+     */
+    @Test
+    @SuppressWarnings("deprecation")
+    public void testTankDriveFollowerChangeGains() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs robotSpecs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        TankDriveTrajectory traj = new TankDriveTrajectory(robotSpecs, params);
+        Followable<TankDriveMoment> wrapper = new Followable<TankDriveMoment>() {
+            @Override
+            public TankDriveMoment get(double t) {
+                return traj.get(t);
+            }
+
+            @Override
+            public double totalTime() {
+                return traj.totalTime();
+            }
+        };
+
+        FakeTimer timer = new FakeTimer();
+        FakeEncoder lEncoder = new FakeEncoder();
+        FakeEncoder rEncoder = new FakeEncoder();
+        FakeGyro gyro = new FakeGyro();
+        FakeMotor lMotor = new FakeMotor();
+        FakeMotor rMotor = new FakeMotor();
+        FakeMotor lMotorJava = new FakeMotor();
+        FakeMotor rMotorJava = new FakeMotor();
+        // Start with no gains at all, so that every change shows up in the outputs
+        TankDriveGains gains = new TankDriveGains();
+        TankDriveFollower follower = new TankDriveFollower(traj,
+                new TankDriveRobot(lMotor, rMotor, lEncoder, rEncoder, timer, gyro), gains);
+        TankDriveFollower javaFollower = new TankDriveFollower(wrapper,
+                new TankDriveRobot(lMotorJava, rMotorJava, lEncoder, rEncoder, timer, gyro), gains);
+
+        // Each term is kept small enough that the outputs are never clamped
+        int iterations = 20;
+        double dt = traj.totalTime() / iterations;
+        double kV = helper.getDouble("kV", 0.15) / robotSpecs.getMaxVelocity();
+        double kA = helper.getDouble("kA", 0.15) / robotSpecs.getMaxAcceleration();
+        double kP = helper.getDouble("kP", 0.15);
+        double kI = helper.getDouble("kI", 0.15) / traj.totalTime();
+        double kD = helper.getDouble("kD", 0.15) * dt / 2;
+        double kDP = helper.getDouble("kDP", 0.15) / Math.PI;
+
+        follower.initialize();
+        javaFollower.initialize();
+        for (int i = 1; i <= iterations; i++) {
+            for (TankDriveFollower f : new TankDriveFollower[] { follower, javaFollower }) {
+                switch (i) {
+                case 2:
+                    f.setV(kV);
+                    break;
+                case 4:
+                    f.setA(kA);
+                    break;
+                case 6:
+                    f.setP(kP);
+                    break;
+                case 8:
+                    f.setI(kI);
+                    break;
+                case 10:
+                    f.setD(kD);
+                    break;
+                case 12:
+                    f.setDP(kDP);
+                    break;
+                case 14:
+                    f.setGains(kV / 2, kA / 2, kP / 2, kI / 2, kD / 2);
+                    break;
+                case 16:
+                    f.setGains(new Follower.Gains(kV, kA, kP, kI, kD));
+                    break;
+                case 18:
+                    f.setGains(kV / 2, kA / 2, kP / 2, kI / 2, kD / 2, kDP / 2);
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            timer.value = dt * i;
+            // Stay within 1 of the trajectory, so that the errors are small
+            TankDriveMoment m = traj.get(timer.value);
+            lEncoder.value = m.getLeftPosition() + helper.getDouble("lErr" + i, -1, 1);
+            rEncoder.value = m.getRightPosition() + helper.getDouble("rErr" + i, -1, 1);
+            gyro.value = helper.getDouble("direction" + i, -Math.PI, Math.PI);
+            follower.run();
+            javaFollower.run();
+
+            assertThat("Left outputs should be the same after changing the gains", lMotor.value,
+                    closeTo(lMotorJava.value, MathUtils.getFloatCompareThreshold()));
+            assertThat("Right outputs should be the same after changing the gains", rMotor.value,
+                    closeTo(rMotorJava.value, MathUtils.getFloatCompareThreshold()));
+        }
+
+        follower.stop();
+        traj.free();
+    }
+
+    /**
+     * Performs telemetry testing on {@link TankDriveFollower}.
+     * 
+     * This test runs a {@link TankDriveFollower} with a {@link TelemetryBuffer}
+     * for a number of iterations with random sensor readings, then drains the
+     * buffer and asserts that there is one record for each iteration, matching the
+     * state of the follower at that iteration.
+     */
+    @Test
+    public void testTankDriveFollowerTelemetry() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        RobotSpecs robotSpecs = TrajectoryTestingUtils.getRandomRobotSpecs(helper, true);
+        TrajectoryParams params = TrajectoryTestingUtils.getRandomTrajectoryParams(helper);
+        TankDriveTrajectory traj = new TankDriveTrajectory(robotSpecs, params);
+
+        FakeTimer timer = new FakeTimer();
+        FakeEncoder lEncoder = new FakeEncoder();
+        FakeEncoder rEncoder = new FakeEncoder();
+        FakeGyro gyro = new FakeGyro();
+        TankDriveGains gains = new TankDriveGains(helper.getDouble("kV", 1), helper.getDouble("kA", 1),
+                helper.getDouble("kP", 1), helper.getDouble("kI", 1), helper.getDouble("kD", 1),
+                helper.getDouble("kDP", 1));
+        TankDriveFollower follower = new TankDriveFollower(traj,
+                new TankDriveRobot(new FakeMotor(), new FakeMotor(), lEncoder, rEncoder, timer, gyro), gains);
+
+        int iterations = 20;
+        double[] lErrors = new double[iterations];
+        double[] rOutputs = new double[iterations];
+        double[] dirErrors = new double[iterations];
+        try (TelemetryBuffer telemetry = new TelemetryBuffer(64)) {
+            follower.setTelemetry(telemetry);
+            follower.initialize();
+            for (int i = 0; i < iterations; i++) {
+                timer.value = traj.totalTime() * (i + 1) / (iterations + 1);
+                lEncoder.value = helper.getDouble("lPos" + i, -1000, 1000);
+                rEncoder.value = helper.getDouble("rPos" + i, -1000, 1000);
+                gyro.value = helper.getDouble("direction" + i, -Math.PI, Math.PI);
+                follower.run();
+                lErrors[i] = follower.lastLeftError();
+                rOutputs[i] = follower.lastRightOutput();
+                dirErrors[i] = follower.lastDirectionalError();
+            }
+
+            assertThat("There should be one record per iteration", telemetry.size(), equalTo(iterations));
+            ByteBuffer buffer = TelemetryBuffer.allocate(iterations);
+            assertThat(telemetry.drain(buffer), equalTo(iterations));
+            assertThat("The buffer should be empty after draining", telemetry.size(), equalTo(0));
+            assertThat(telemetry.dropped(), equalTo(0L));
+
+            buffer.flip();
+            for (int i = 0; i < iterations; i++) {
+                TelemetryBuffer.Record r = TelemetryBuffer.Record.read(buffer);
+                assertThat(r.timestamp, equalTo(traj.totalTime() * (i + 1) / (iterations + 1)));
+                assertThat(r.leftError, equalTo(lErrors[i]));
+                assertThat(r.rightOutput, equalTo(rOutputs[i]));
+                assertThat(r.directionalError, equalTo(dirErrors[i]));
+            }
+        }
+
+        follower.stop();
+        traj.free();
+    }
 }
@@ -327,4 +327,43 @@ public class TrapezoidalMotionProfileTest {
 
         TestHelper.assertAllFieldsEqual(profile, copiedProfile);
     }
+
+    /**
+     * Performs testing on
+     * {@link TrapezoidalMotionProfile#sample(double[], double[], double[], double[])}.
+     * 
+     * This test constructs a {@link TrapezoidalMotionProfile}, samples it at 100
+     * different points in time with a single call, and asserts that the results
+     * are the same as the ones returned by the methods that only take one time.
+     */
+    @Test
+    public void testTrapezoidalMotionProfileSample() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        double maxV = helper.getDouble("maxV", 1000);
+        double maxA = helper.getDouble("maxA", 1000);
+        double distance = helper.getDouble("distance", -1000, 1000);
+
+        RobotSpecs specs = new RobotSpecs(maxV, maxA);
+
+        TrapezoidalMotionProfile profile = new TrapezoidalMotionProfile(specs, distance);
+        double[] times = new double[100];
+        for (int i = 0; i < times.length; i++) {
+            times[i] = profile.totalTime() * i / (times.length - 1);
+        }
+        double[] pos = new double[times.length];
+        double[] vel = new double[times.length];
+        double[] accel = new double[times.length];
+        profile.sample(times, pos, vel, accel);
+
+        for (int i = 0; i < times.length; i++) {
+            assertThat("Sampled position should be the same", pos[i],
+                    closeTo(profile.position(times[i]), MathUtils.getFloatCompareThreshold()));
+            assertThat("Sampled velocity should be the same", vel[i],
+                    closeTo(profile.velocity(times[i]), MathUtils.getFloatCompareThreshold()));
+            assertThat("Sampled acceleration should be the same", accel[i],
+                    closeTo(profile.acceleration(times[i]), MathUtils.getFloatCompareThreshold()));
+        }
+        profile.close();
+    }
 }
@@ -5,6 +5,7 @@ import static org.hamcrest.Matchers.either;
 import static org.hamcrest.Matchers.greaterThan;
 import static org.hamcrest.Matchers.lessThan;
 import static org.junit.Assert.assertThat;
+import static org.junit.Assert.fail;
 
 import com.arctos6135.robotpathfinder.core.RobotSpecs;
 import com.arctos6135.robotpathfinder.core.trajectory.BasicMoment;
@@ -196,4 +197,33 @@ public class TrapezoidalBasicProfileTest {
 
         TestHelper.assertAllFieldsEqual(f, f.copy());
     }
+
+    /**
+     * Tests that {@link TrapezoidalBasicProfile#close()} frees the native profiles, and that a
+     * copy can still be used afterwards.
+     */
+    @Test
+    public void testTrapezoidalBasicProfileClose() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        double maxV = helper.getDouble("maxV", 1000);
+        double maxA = helper.getDouble("maxA", 1000);
+        double distance = helper.getDouble("distance", 1000);
+
+        RobotSpecs specs = new RobotSpecs(maxV, maxA);
+
+        TrapezoidalBasicProfile f = new TrapezoidalBasicProfile(specs, distance);
+        TrapezoidalBasicProfile copy = f.copy();
+        f.close();
+        try {
+            f.get(0);
+            fail("The profile should have been freed");
+        } catch (IllegalStateException e) {
+            // Expected
+        }
+
+        assertThat("The copy should still be usable", copy.get(copy.totalTime()).getPosition(),
+                closeTo(distance, MathUtils.getFloatCompareThreshold()));
+        copy.close();
+    }
 }
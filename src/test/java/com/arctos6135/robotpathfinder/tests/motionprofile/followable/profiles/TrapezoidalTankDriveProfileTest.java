@@ -5,6 +5,7 @@ import static org.hamcrest.Matchers.either;
 import static org.hamcrest.Matchers.greaterThan;
 import static org.hamcrest.Matchers.lessThan;
 import static org.junit.Assert.assertThat;
+import static org.junit.Assert.fail;
 
 import com.arctos6135.robotpathfinder.core.RobotSpecs;
 import com.arctos6135.robotpathfinder.core.trajectory.TankDriveMoment;
@@ -248,4 +249,33 @@ public class TrapezoidalTankDriveProfileTest {
 
         TestHelper.assertAllFieldsEqual(f, f.copy());
     }
+
+    /**
+     * Tests that {@link TrapezoidalTankDriveProfile#close()} frees the native profiles, and that a
+     * copy can still be used afterwards.
+     */
+    @Test
+    public void testTrapezoidalTankDriveProfileClose() {
+        TestHelper helper = new TestHelper(getClass(), testName);
+
+        double maxV = helper.getDouble("maxV", 1000);
+        double maxA = helper.getDouble("maxA", 1000);
+        double distance = helper.getDouble("distance", 1000);
+
+        RobotSpecs specs = new RobotSpecs(maxV, maxA);
+
+        TrapezoidalTankDriveProfile f = new TrapezoidalTankDriveProfile(specs, distance);
+        TrapezoidalTankDriveProfile copy = f.copy();
+        f.close();
+        try {
+            f.get(0);
+            fail("The profile should have been freed");
+        } catch (IllegalStateException e) {
+            // Expected
+        }
+
+        assertThat("The copy should still be usable", copy.get(copy.totalTime()).getLeftPosition(),
+                closeTo(distance, MathUtils.getFloatCompareThreshold()));
+        copy.close();
+    }
 }